@@ -11,6 +11,9 @@ example_dir=examples/fem_system/$example_name
 # First, run with standard options from input files.
 run_example "$example_name"
 
+# Rerun with staged assembly
+run_example "$example_name" "staged_assembly=true staged_assembly_batch_size=16"
+
 # Next, lets run with pure fieldsplit without gmg, if we have PETSc
 
 if [ "x$petscmajor" == "x" ]; then
@@ -256,6 +256,36 @@ public:
    */
   void clear_sparsity();
 
+  /**
+   * Frees the column indices of a CSR sparsity pattern, keeping only
+   * the n_nz and n_oz counts.  This should be called once every
+   * attached matrix has been initialized, since the pattern can be
+   * as large as the matrix graph itself; matrices initialized
+   * afterward preallocate from the counts alone.
+   */
+  void clear_csr_sparsity();
+
+  /**
+   * Use a SparsityPattern::CSRBuild, rather than a
+   * SparsityPattern::Build, in compute_sparsity().  This computes
+   * the exact pattern with less memory and more parallelism, and
+   * keeps it until clear_sparsity() so that matrices can preallocate
+   * from it; see get_csr_sparsity_pattern().
+   *
+   * This is ignored if an attached matrix needs the full sparsity
+   * pattern, or if an extra sparsity function or object has been
+   * attached, since those all work on a SparsityPattern::Graph.
+   */
+  void set_use_csr_sparsity (bool use_csr_sparsity)
+  { _use_csr_sparsity = use_csr_sparsity; }
+
+  /**
+   * \returns \p true if compute_sparsity() should build a CSR
+   * sparsity pattern where it can.
+   */
+  bool use_csr_sparsity () const
+  { return _use_csr_sparsity; }
+
   /**
    * Remove any default ghosting functor(s).  User-added ghosting
    * functors will be unaffected.
@@ -521,6 +551,16 @@ public:
     return *_n_oz;
   }
 
+  /**
+   * \returns The exact sparsity pattern, in compressed sparse row
+   * form, of the rows of the global matrix that the current
+   * processor owns, or \p nullptr if compute_sparsity() did not
+   * build one or it has since been freed.  See
+   * set_use_csr_sparsity() and clear_csr_sparsity().
+   */
+  const SparsityPattern::CSRGraph * get_csr_sparsity_pattern() const
+  { return _csr_sp ? &_csr_sp->csr_pattern : nullptr; }
+
   // /**
   //  * Add an unknown of order \p order and finite element type
   //  * \p type to the system of equations.
@@ -999,12 +1039,14 @@ public:
   {
     libmesh_assert(_stashed_dof_constraints.empty());
     _dof_constraints.swap(_stashed_dof_constraints);
+    _local_constrained_dofs.swap(_stashed_local_constrained_dofs);
   }
 
   void unstash_dof_constraints()
   {
     libmesh_assert(_dof_constraints.empty());
     _dof_constraints.swap(_stashed_dof_constraints);
+    _local_constrained_dofs.swap(_stashed_local_constrained_dofs);
   }
 
   /**
@@ -1022,6 +1064,7 @@ public:
   void swap_dof_constraints()
   {
     _dof_constraints.swap(_stashed_dof_constraints);
+    _local_constrained_dofs.swap(_stashed_local_constrained_dofs);
   }
 
 #ifdef LIBMESH_ENABLE_NODE_CONSTRAINTS
@@ -1479,6 +1522,11 @@ private:
    */
   std::unique_ptr<SparsityPattern::Build> build_sparsity(const MeshBase & mesh) const;
 
+  /**
+   * Builds an exact sparsity pattern in compressed sparse row form
+   */
+  std::unique_ptr<SparsityPattern::CSRBuild> build_csr_sparsity(const MeshBase & mesh) const;
+
   /**
    * Invalidates all active DofObject dofs for this system
    */
@@ -1609,6 +1657,12 @@ private:
    */
   void add_constraints_to_send_list();
 
+  /**
+   * Rebuilds the \p _local_constrained_dofs bitmap from
+   * \p _dof_constraints.
+   */
+  void build_local_constrained_dofs();
+
 #endif // LIBMESH_ENABLE_CONSTRAINTS
 
   /**
@@ -1761,6 +1815,19 @@ private:
    */
   std::unique_ptr<SparsityPattern::Build> _sp;
 
+  /**
+   * True if compute_sparsity() should use a SparsityPattern::CSRBuild
+   * when it can.
+   */
+  bool _use_csr_sparsity;
+
+  /**
+   * The CSR sparsity pattern of the global matrix, if that is what
+   * compute_sparsity() built.  Its n_nz and n_oz arrays are swapped
+   * into _n_nz and _n_oz.
+   */
+  std::unique_ptr<SparsityPattern::CSRBuild> _csr_sp;
+
   /**
    * The number of on-processor nonzeros in my portion of the
    * global matrix.  If need_full_sparsity_pattern is true, this will
@@ -1818,6 +1885,17 @@ private:
    */
   DofConstraints _dof_constraints, _stashed_dof_constraints;
 
+  /**
+   * Which of our local DOFs, starting from
+   * _local_constrained_dofs_begin, have rows in _dof_constraints, so
+   * that is_constrained_dof() can skip the tree lookup for them.
+   * This is built at the end of process_constraints() and emptied
+   * whenever constraints are being recomputed; while it is empty
+   * every lookup falls back on _dof_constraints.
+   */
+  std::vector<bool> _local_constrained_dofs, _stashed_local_constrained_dofs;
+  dof_id_type _local_constrained_dofs_begin;
+
   DofConstraintValueMap      _primal_constraint_values;
 
   AdjointDofConstraintValues _adjoint_constraint_values;
@@ -1961,6 +2039,12 @@ bool DofMap::is_constrained_node (const Node *
 inline
 bool DofMap::is_constrained_dof (const dof_id_type dof) const
 {
+  // Local dofs are in the bitmap, if it is up to date.  Any other dof
+  // wraps around to an out of range index.
+  const dof_id_type local_index = dof - _local_constrained_dofs_begin;
+  if (local_index < _local_constrained_dofs.size())
+    return _local_constrained_dofs[local_index];
+
   if (_dof_constraints.count(dof))
     return true;
 
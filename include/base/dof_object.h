@@ -28,6 +28,10 @@
 #include "libmesh/libmesh.h" // libMesh::invalid_uint
 #include "libmesh/reference_counted_object.h"
 
+#ifdef LIBMESH_ENABLE_INLINE_DOF_INDICES
+#include "libmesh/small_vector.h"
+#endif
+
 // C++ includes
 #include <cstddef>
 #include <cstring>
@@ -607,9 +611,25 @@ private:
    * [-5 11 11 13 17 () (ncv_0 idx_0 ncv_1 idx_1 ncv_2 idx_2) () (ncv_0 idx_0) (ncv_0 idx_0 ncv_1 idx_1) (xtra1 xtra2)]
    * [0   1  2  3  4         5     6     7     8     9    10         11    12      13    14    15    16      17    18]
    * \endverbatim
+   *
+   * If libMesh is configured with --enable-inline-dof-indices, the
+   * buffer is stored inside the DofObject itself whenever it has no
+   * more than \p idx_buf_inline_size entries, which covers a single
+   * system with a single variable group, so that such meshes never
+   * make a separate heap allocation for each Node and Elem.  On 64-bit
+   * platforms that costs no space with 4-byte dof ids, but with
+   * 8-byte dof ids it makes every DofObject 16 bytes larger, so it
+   * is disabled by default.
    */
   typedef dof_id_type index_t;
+
+#ifdef LIBMESH_ENABLE_INLINE_DOF_INDICES
+  static const unsigned int idx_buf_inline_size = 4;
+
+  typedef SmallVector<index_t, idx_buf_inline_size> index_buffer_t;
+#else
   typedef std::vector<index_t> index_buffer_t;
+#endif
   index_buffer_t _idx_buf;
 
   /**
@@ -648,7 +668,7 @@ private:
 #ifdef LIBMESH_IS_UNIT_TESTING
 public:
   void set_buffer (const std::vector<dof_id_type> & buf)
-  { _idx_buf = buf; }
+  { _idx_buf.assign(buf.begin(), buf.end()); }
 #endif
 };
 
@@ -67,24 +67,39 @@ struct PerfItem
            const char * header,
            bool enabled=true,
            PerfLog * my_perflog=&perflog) :
-    _label(label),
-    _header(header),
+    _event_id(enabled ? PerfLog::intern(label, header).id : 0),
     _enabled(enabled),
     _perflog(*my_perflog)
   {
     if (_enabled)
-      _perflog.fast_push(label, header);
+      _perflog.fast_push(_event_id);
+  }
+
+  /**
+   * As above, but with the interned event looked up through the
+   * call site's \p cache; this is what the LOG_SCOPE macros use.
+   */
+  PerfItem(const char * label,
+           const char * header,
+           std::atomic<const PerfEvent *> & cache,
+           bool enabled=true,
+           PerfLog * my_perflog=&perflog) :
+    _event_id(enabled ? PerfLog::intern(label, header, cache) : 0),
+    _enabled(enabled),
+    _perflog(*my_perflog)
+  {
+    if (_enabled)
+      _perflog.fast_push(_event_id);
   }
 
   ~PerfItem()
   {
     if (_enabled)
-      _perflog.fast_pop(_label, _header);
+      _perflog.fast_pop(_event_id);
   }
 
 private:
-  const char * _label;
-  const char * _header;
+  unsigned int _event_id;
   bool _enabled;
   PerfLog & _perflog;
 };
@@ -107,9 +122,12 @@ private:
 #  define PALIBMESH_USE_LOG(a,b)   { libmesh_deprecated(); }
 #  define RESTART_LOG(a,b) { libmesh_deprecated(); }
 #endif
-#  define LOG_SCOPE(a,b)   libMesh::PerfItem TOKENPASTE2(perf_item_, __LINE__)(a,b);
-#  define LOG_SCOPE_IF(a,b,enabled)   libMesh::PerfItem TOKENPASTE2(perf_item_, __LINE__)(a,b,enabled);
-#  define LOG_SCOPE_WITH(a,b,logger)   libMesh::PerfItem TOKENPASTE2(perf_item_, __LINE__)(a,b,true,&logger);
+// Each scope caches its interned event in a function-local static,
+// so in steady state it does no lookup at all.
+#  define PERF_EVENT_CACHE static std::atomic<const libMesh::PerfEvent *> TOKENPASTE2(perf_event_, __LINE__) {nullptr};
+#  define LOG_SCOPE(a,b)   PERF_EVENT_CACHE libMesh::PerfItem TOKENPASTE2(perf_item_, __LINE__)(a,b,TOKENPASTE2(perf_event_, __LINE__));
+#  define LOG_SCOPE_IF(a,b,enabled)   PERF_EVENT_CACHE libMesh::PerfItem TOKENPASTE2(perf_item_, __LINE__)(a,b,TOKENPASTE2(perf_event_, __LINE__),enabled);
+#  define LOG_SCOPE_WITH(a,b,logger)   PERF_EVENT_CACHE libMesh::PerfItem TOKENPASTE2(perf_item_, __LINE__)(a,b,TOKENPASTE2(perf_event_, __LINE__),true,&logger);
 
 #else
 
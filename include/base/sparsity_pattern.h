@@ -53,6 +53,34 @@ class Graph : public std::vector<Row> {};
 
 class NonlocalGraph : public std::map<dof_id_type, Row> {};
 
+/**
+ * The sparsity pattern of the locally owned rows of a matrix in
+ * compressed sparse row form.  The sorted global column indices of
+ * local row r are col_idx[row_ptr[r]], ..., col_idx[row_ptr[r+1]-1].
+ *
+ * Unlike a Graph there is no container per row, and the arrays can
+ * be handed directly to matrix formats which preallocate from CSR
+ * data.
+ */
+class CSRGraph
+{
+public:
+  std::vector<std::size_t> row_ptr;
+  std::vector<dof_id_type> col_idx;
+
+  /**
+   * \returns The number of local rows.
+   */
+  dof_id_type n_rows() const
+  { return row_ptr.empty() ? 0 : cast_int<dof_id_type>(row_ptr.size() - 1); }
+
+  /**
+   * \returns The number of nonzeros in the local rows.
+   */
+  std::size_t n_nonzeros() const
+  { return row_ptr.empty() ? 0 : row_ptr.back(); }
+};
+
 /**
  * Splices the two sorted ranges [begin,middle) and [middle,end)
  * into one sorted range [begin,end).  This method is much like
@@ -80,7 +108,7 @@ static void sort_row (const BidirectionalIterator begin,
  */
 class Build : public ParallelObject
 {
-private:
+protected:
   const MeshBase & mesh;
   const DofMap & dof_map;
   const CouplingMatrix * dof_coupling;
@@ -99,13 +127,30 @@ private:
   // unnecessary caluclations.
   std::unordered_set<dof_id_type> hashed_dof_sets;
 
-  void handle_vi_vj(const std::vector<dof_id_type> & element_dofs_i,
-                    const std::vector<dof_id_type> & element_dofs_j);
+  /**
+   * \returns \p true if the coupling of \p element_dofs_i to
+   * \p element_dofs_j is known to have been handled already.
+   */
+  bool dofs_seen(const std::vector<dof_id_type> & element_dofs_i,
+                 const std::vector<dof_id_type> & element_dofs_j);
+
+  /**
+   * Adds the coupling of each of the sorted \p element_dofs_i to
+   * each of the sorted \p element_dofs_j.
+   */
+  virtual void handle_vi_vj(const std::vector<dof_id_type> & element_dofs_i,
+                            const std::vector<dof_id_type> & element_dofs_j);
 
   void sorted_connected_dofs(const Elem * elem,
                              std::vector<dof_id_type> & dofs_vi,
                              unsigned int vi);
 
+  /**
+   * Calls handle_vi_vj() for every pair of dof sets coupled, via the
+   * DofMap coupling functors, by the elements in \p range.
+   */
+  void couple_elements(const ConstElemRange & range);
+
 public:
 
   SparsityPattern::Graph sparsity_pattern;
@@ -130,6 +175,86 @@ public:
   void parallel_sync ();
 };
 
+
+
+/**
+ * An alternative to Build which computes the exact sparsity pattern
+ * of the local rows as a CSRGraph.
+ *
+ * Rather than merging every element's couplings into sorted rows as
+ * it goes, each thread only records the dense blocks of dofs coupled
+ * by its elements.  Once blocks with off-processor rows have been
+ * sent to their owners, the pattern is compressed in two threaded
+ * passes over the local rows: one counting the distinct columns of
+ * each row, and one filling them into the preallocated col_idx
+ * array.  There is no per-row container and no nonlocal row map, so
+ * both the peak memory use and the serial merging work of Build are
+ * avoided.
+ *
+ * The n_nz and n_oz counts are exact; sparsity_pattern and
+ * nonlocal_pattern are left empty.
+ */
+class CSRBuild : public Build
+{
+private:
+  /**
+   * Dense blocks of the matrix graph, packed into one array: block b
+   * couples each row dofs[bounds[2b]], ..., dofs[bounds[2b+1]-1] to
+   * each column dofs[bounds[2b+1]], ..., dofs[bounds[2b+2]-1].
+   */
+  struct CouplingBlocks
+  {
+    std::vector<dof_id_type> dofs;
+    std::vector<std::size_t> bounds = std::vector<std::size_t>(1, 0);
+
+    std::size_t size() const { return bounds.size() / 2; }
+
+    /**
+     * Completes a block whose rows have been pushed onto \p dofs, if
+     * there are any, with the columns \p cols.
+     */
+    void finish_block (const std::vector<dof_id_type> & cols);
+
+    void append (const CouplingBlocks & other);
+
+    void clear ();
+  };
+
+  CouplingBlocks local_blocks;
+  CouplingBlocks nonlocal_blocks;
+
+  /**
+   * Compresses local_blocks into csr_pattern, n_nz and n_oz.
+   */
+  void compress ();
+
+protected:
+  virtual void handle_vi_vj(const std::vector<dof_id_type> & element_dofs_i,
+                            const std::vector<dof_id_type> & element_dofs_j) override;
+
+public:
+
+  CSRGraph csr_pattern;
+
+  CSRBuild (const MeshBase & mesh_in,
+            const DofMap & dof_map_in,
+            const CouplingMatrix * dof_coupling_in,
+            const std::set<GhostingFunctor *> & coupling_functors_in,
+            const bool implicit_neighbor_dofs_in);
+
+  CSRBuild (CSRBuild & other, Threads::split);
+
+  void operator()(const ConstElemRange & range);
+
+  void join (const CSRBuild & other);
+
+  /**
+   * Sends blocks with nonlocal rows to the processors owning those
+   * rows, then builds csr_pattern.
+   */
+  void parallel_sync ();
+};
+
 #if defined(__GNUC__) && (__GNUC__ < 4) && !defined(__INTEL_COMPILER)
 /**
  * Dummy function that does nothing but can be used to prohibit
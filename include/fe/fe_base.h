@@ -517,6 +517,15 @@ protected:
    */
   std::vector<std::vector<OutputShape>>   phi;
 
+  /**
+   * True if \p phi was filled in at the quadrature points by
+   * init_shape_functions(), for a family whose shape functions
+   * depend on nothing but the element type and p level, so that
+   * compute_shape_functions() need not evaluate them again for every
+   * element.
+   */
+  bool phi_precomputed;
+
   /**
    * Shape function derivative values.
    */
@@ -698,6 +707,7 @@ FEGenericBase<OutputType>::FEGenericBase(const unsigned int d,
   FEAbstract(d,fet),
   _fe_trans( FETransformationBase<OutputType>::build(fet) ),
   phi(),
+  phi_precomputed(false),
   dphi(),
   curl_phi(),
   div_phi(),
@@ -0,0 +1,230 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FE_BATCH_H
+#define LIBMESH_FE_BATCH_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/enum_elem_type.h"
+#include "libmesh/fe_type.h"
+
+// C++ includes
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class Elem;
+class QBase;
+
+/**
+ * The \p FEBatch class computes finite element data on a block of
+ * elements of the same type and p level at once.
+ *
+ * Where an FE object stores its data one element at a time, indexed
+ * by [shape function][quadrature point], an FEBatch stores data for
+ * the whole block with the element index innermost: the values for
+ * all elements at one quadrature point (and shape function and
+ * component, where relevant) are contiguous.  The loops computing the
+ * element maps run over that innermost index, so the compiler can
+ * vectorize them across elements, and user kernels written the same
+ * way can do likewise:
+ *
+ * \code
+ * batch.reinit(elems);
+ * for (unsigned int qp = 0; qp != batch.n_qp(); ++qp)
+ *   {
+ *     const Real * JxW = batch.JxW(qp);
+ *     const Real * dudx = ...;
+ *     for (unsigned int e = 0; e != batch.n_elem(); ++e)
+ *       residual[e] += JxW[e] * dudx[e] * ...;
+ *   }
+ * \endcode
+ *
+ * Only scalar families whose shape functions depend on nothing but
+ * the element type and p level (LAGRANGE, L2_LAGRANGE, MONOMIAL) on
+ * Lagrange-mapped elements are supported, and elements must not be
+ * embedded in a higher dimensional space: a dim-dimensional element
+ * uses only the first dim coordinates of its nodes.
+ */
+class FEBatch
+{
+public:
+
+  /**
+   * Constructor.  Prepares to compute data for a \p dim dimensional
+   * finite element of type \p fe_type, integrated with the rule
+   * \p qrule.
+   */
+  FEBatch (unsigned int dim,
+           const FEType & fe_type,
+           std::unique_ptr<QBase> qrule);
+
+  ~FEBatch ();
+
+  /**
+   * Computes all data for the elements \p elems, which must all have
+   * the same type and p level.  Reference data is only recomputed
+   * when the element type or p level changes.
+   */
+  void reinit (const std::vector<const Elem *> & elems);
+
+  unsigned int dim () const { return _dim; }
+
+  const FEType & get_fe_type () const { return _fe_type; }
+
+  const QBase & get_qrule () const { return *_qrule; }
+
+  /**
+   * \returns The number of elements in the current batch.
+   */
+  unsigned int n_elem () const { return _n_elem; }
+
+  /**
+   * \returns The number of quadrature points per element.
+   */
+  unsigned int n_qp () const { return _n_qp; }
+
+  /**
+   * \returns The number of shape functions per element.
+   */
+  unsigned int n_shape_functions () const { return _n_shapes; }
+
+  /**
+   * \returns The distance between the data for successive quadrature
+   * points (or components, or shape functions) in the arrays
+   * below: the number of elements, rounded up to a multiple of
+   * \p simd_width so that kernels can work on whole SIMD widths of
+   * elements at a time without reading past the end of a row.
+   * Entries past \p n_elem() are padding.
+   *
+   * \note The arrays are allocated by std::vector, so rows are only
+   * aligned to alignof(Real), not to the SIMD width.
+   */
+  std::size_t stride () const { return _stride; }
+
+  /**
+   * The number of Reals each row is padded to a multiple of.
+   */
+  static const unsigned int simd_width = 8;
+
+  /**
+   * The shape function values, [shape function][quadrature point].
+   * These are the same on every element.
+   */
+  const std::vector<std::vector<Real>> & get_phi () const { return _phi; }
+
+  /**
+   * \returns A pointer to the quadrature weight times Jacobian
+   * determinant at quadrature point \p qp, for each element.
+   */
+  const Real * JxW (unsigned int qp) const
+  { return &_JxW[qp * _stride]; }
+
+  /**
+   * \returns A pointer to component \p d of the physical location of
+   * quadrature point \p qp, for each element.
+   */
+  const Real * xyz (unsigned int qp, unsigned int d) const
+  { return &_xyz[(qp * _dim + d) * _stride]; }
+
+  /**
+   * \returns A pointer to the derivative of reference coordinate \p k
+   * with respect to physical coordinate \p d at quadrature point
+   * \p qp, for each element.
+   */
+  const Real * inverse_jacobian (unsigned int qp,
+                                 unsigned int k,
+                                 unsigned int d) const
+  { return &_inverse_jacobian[((qp * _dim + k) * _dim + d) * _stride]; }
+
+  /**
+   * \returns A pointer to component \p d of the physical gradient of
+   * shape function \p i at quadrature point \p qp, for each element.
+   */
+  const Real * dphi (unsigned int i,
+                     unsigned int qp,
+                     unsigned int d) const
+  { return &_dphi[((i * _n_qp + qp) * _dim + d) * _stride]; }
+
+  /**
+   * \returns The element at index \p e in the current batch.
+   */
+  const Elem * elem (unsigned int e) const
+  {
+    libmesh_assert_less (e, _elems.size());
+    return _elems[e];
+  }
+
+private:
+
+  /**
+   * Computes the reference shape function and mapping tables for
+   * elements like \p elem.
+   */
+  void init_reference_data (const Elem & elem);
+
+  const unsigned int _dim;
+
+  const FEType _fe_type;
+
+  std::unique_ptr<QBase> _qrule;
+
+  /**
+   * The element type and p level our reference data is for.
+   */
+  ElemType _elem_type;
+  unsigned int _p_level;
+
+  unsigned int _n_elem;
+  unsigned int _n_qp;
+  unsigned int _n_shapes;
+  unsigned int _n_map_shapes;
+  std::size_t _stride;
+
+  std::vector<const Elem *> _elems;
+
+  /**
+   * Reference data: shape function values and reference gradients,
+   * and mapping function values and reference gradients.  Gradients
+   * are stored [function][quadrature point][reference direction].
+   */
+  std::vector<std::vector<Real>> _phi;
+  std::vector<Real> _dphiref;
+  std::vector<Real> _phi_map;
+  std::vector<Real> _dphiref_map;
+
+  /**
+   * Per-element data, element index innermost.
+   */
+  std::vector<Real> _nodes;
+  std::vector<Real> _JxW;
+  std::vector<Real> _xyz;
+  std::vector<Real> _jacobian;
+  std::vector<Real> _inverse_jacobian;
+  std::vector<Real> _dphi;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_FE_BATCH_H
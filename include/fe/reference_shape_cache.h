@@ -0,0 +1,149 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_REFERENCE_SHAPE_CACHE_H
+#define LIBMESH_REFERENCE_SHAPE_CACHE_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/enum_elem_type.h"
+#include "libmesh/enum_fe_family.h"
+#include "libmesh/point.h"
+
+// C++ includes
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class FEType;
+
+/**
+ * The \p ReferenceShapeCache class stores tables of shape function
+ * values and reference derivatives at quadrature points, shared by
+ * every FE object in the process.
+ *
+ * For families like LAGRANGE and MONOMIAL these tables depend only on
+ * the element type, the approximation order, the p level and the
+ * points themselves, so FE objects which switch between element types
+ * (or which are constructed afresh for each batch of elements, as in
+ * threaded assembly) can copy them rather than evaluate every shape
+ * function at every point again.
+ *
+ * Tables are looked up by the exact reference points they were
+ * computed at.  All methods are thread-safe.
+ */
+template <typename OutputShape>
+class ReferenceShapeCache
+{
+public:
+
+  /**
+   * Shape function tables at a set of reference points, indexed
+   * the same way as the corresponding FEGenericBase data,
+   * i.e. [shape function][point].
+   */
+  struct Tables
+  {
+    Tables () :
+      have_phi(false),
+      have_dphiref(false),
+      have_d2phiref(false)
+    {}
+
+    std::vector<Point> points;
+
+    bool have_phi;
+    bool have_dphiref;
+    bool have_d2phiref;
+
+    std::vector<std::vector<OutputShape>> phi;
+
+    std::vector<std::vector<OutputShape>> dphidxi;
+    std::vector<std::vector<OutputShape>> dphideta;
+    std::vector<std::vector<OutputShape>> dphidzeta;
+
+#ifdef LIBMESH_ENABLE_SECOND_DERIVATIVES
+    std::vector<std::vector<OutputShape>> d2phidxi2;
+    std::vector<std::vector<OutputShape>> d2phidxideta;
+    std::vector<std::vector<OutputShape>> d2phidxidzeta;
+    std::vector<std::vector<OutputShape>> d2phideta2;
+    std::vector<std::vector<OutputShape>> d2phidetadzeta;
+    std::vector<std::vector<OutputShape>> d2phidzeta2;
+#endif
+  };
+
+  /**
+   * \returns \p true if shape functions of the given family depend on
+   * nothing but the element type and p level, so that their tables
+   * may be cached.
+   */
+  static bool supports (FEFamily family);
+
+  /**
+   * \returns The cached tables for a \p dim dimensional \p fe_type
+   * on elements of type \p type and p level \p p_level at exactly the
+   * points \p points, or nullptr if no tables with at least the
+   * requested data have been cached.
+   */
+  static std::shared_ptr<const Tables>
+  find (unsigned int dim,
+        const FEType & fe_type,
+        ElemType type,
+        unsigned int p_level,
+        const std::vector<Point> & points,
+        bool need_phi,
+        bool need_dphiref,
+        bool need_d2phiref);
+
+  /**
+   * Adds \p tables to the cache, merging them with any tables already
+   * cached for the same points.
+   */
+  static void insert (unsigned int dim,
+                      const FEType & fe_type,
+                      ElemType type,
+                      unsigned int p_level,
+                      std::unique_ptr<Tables> tables);
+
+  /**
+   * Empties the cache.  FE objects holding copies of cached data are
+   * unaffected.
+   */
+  static void clear ();
+
+  /**
+   * \returns The number of sets of tables currently cached.
+   */
+  static std::size_t size ();
+
+  /**
+   * The maximum number of distinct point sets we keep tables for
+   * with any one family, order, element type and p level; beyond
+   * this the oldest tables are discarded.
+   */
+  static const unsigned int max_point_sets = 4;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_REFERENCE_SHAPE_CACHE_H
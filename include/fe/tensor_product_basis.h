@@ -0,0 +1,186 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_TENSOR_PRODUCT_BASIS_H
+#define LIBMESH_TENSOR_PRODUCT_BASIS_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/enum_elem_type.h"
+#include "libmesh/fe_type.h"
+#include "libmesh/vector_value.h"
+
+// C++ includes
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class FEMap;
+class QBase;
+template <typename T> class DenseVectorBase;
+
+/**
+ * The \p TensorProductBasis class evaluates finite element fields on
+ * tensor-product elements by sum factorization.
+ *
+ * On quadrilaterals and hexahedra whose shape functions are products
+ * of one-dimensional shape functions, integrated with a tensor-product
+ * Gauss rule, the values (or reference derivatives) of a field at all
+ * quadrature points can be found by applying a one-dimensional basis
+ * matrix along each direction in turn.  With n one-dimensional shape
+ * functions and quadrature points this costs O(n^(dim+1)) operations,
+ * rather than the O(n^(2 dim)) of summing every shape function at
+ * every point.  The transposed operations integrate against every
+ * test function at the same cost, for matrix-free residuals.
+ *
+ * Currently LAGRANGE and L2_LAGRANGE fields on EDGE2/3, QUAD4/9 and
+ * HEX8/27 elements with QGAUSS rules are supported; see supports().
+ * Data are ordered as for the corresponding FE objects, so results
+ * can be used interchangeably with theirs.
+ *
+ * Objects hold scratch space, so each thread needs its own.
+ */
+class TensorProductBasis
+{
+public:
+
+  /**
+   * Constructor.  Prepares to evaluate fields of type \p fe_type on
+   * elements of type \p type and p level \p p_level at the points of
+   * \p qrule, which must already be initialized for such elements.
+   */
+  TensorProductBasis (const FEType & fe_type,
+                      ElemType type,
+                      unsigned int p_level,
+                      const QBase & qrule);
+
+  /**
+   * \returns \p true if fields of type \p fe_type on elements of type
+   * \p type and p level \p p_level can be evaluated by sum
+   * factorization at the points of \p qrule.
+   */
+  static bool supports (const FEType & fe_type,
+                        ElemType type,
+                        unsigned int p_level,
+                        const QBase & qrule);
+
+  unsigned int dim () const { return _dim; }
+
+  unsigned int n_dofs () const { return _n_dofs; }
+
+  unsigned int n_qp () const { return _n_qp; }
+
+  /**
+   * Computes the values \p u at each quadrature point of the field
+   * with element coefficients \p coefs.
+   */
+  void values (const DenseVectorBase<Number> & coefs,
+               std::vector<Number> & u) const;
+
+  /**
+   * Computes the physical gradients \p du at each quadrature point of
+   * the field with element coefficients \p coefs, using the inverse
+   * map Jacobians from \p fe_map, which must have been reinitialized
+   * on the element at our quadrature points.
+   */
+  void gradients (const DenseVectorBase<Number> & coefs,
+                  const FEMap & fe_map,
+                  std::vector<Gradient> & du) const;
+
+  /**
+   * Adds to each \p r(i) the sum over quadrature points of \p f
+   * times shape function \p i.  \p f should already include any
+   * quadrature weights.
+   */
+  void integrate_values (const std::vector<Number> & f,
+                         DenseVectorBase<Number> & r) const;
+
+  /**
+   * Adds to each \p r(i) the sum over quadrature points of \p g dotted
+   * with the physical gradient of shape function \p i.  \p g should
+   * already include any quadrature weights.
+   */
+  void integrate_gradients (const std::vector<Gradient> & g,
+                            const FEMap & fe_map,
+                            DenseVectorBase<Number> & r) const;
+
+private:
+
+  /**
+   * Contracts the tensor \p in, of extents \p extents, along
+   * direction \p axis with the one-dimensional matrix \p M (or its
+   * transpose), writing the result to \p out and updating
+   * \p extents.
+   */
+  void apply (const std::vector<Real> & M,
+              bool transpose,
+              unsigned int axis,
+              unsigned int (&extents)[3],
+              const Number * in,
+              Number * out) const;
+
+  /**
+   * Applies \p matrices[k] (or its transpose) along each direction k
+   * to the tensor in _work[0], leaving the result in _work[0].
+   */
+  void apply_all (const std::vector<Real> * matrices[3],
+                  bool transpose,
+                  unsigned int (&extents)[3]) const;
+
+  /**
+   * Gathers the inverse map Jacobian entries from \p fe_map:
+   * \p dxi[k][d] is the vector of dxi_k/dx_d over quadrature points.
+   */
+  void inverse_jacobian (const FEMap & fe_map,
+                         const std::vector<Real> * dxi[3][3]) const;
+
+  unsigned int _dim;
+
+  /**
+   * Number of one-dimensional shape functions and quadrature points
+   */
+  unsigned int _n_1d;
+  unsigned int _n_qp_1d;
+
+  unsigned int _n_dofs;
+  unsigned int _n_qp;
+
+  /**
+   * One-dimensional shape function values and derivatives,
+   * [quadrature point][shape function]
+   */
+  std::vector<Real> _basis;
+  std::vector<Real> _deriv;
+
+  /**
+   * Element shape function index for each tensor index (x fastest)
+   */
+  std::vector<unsigned int> _tensor_dof;
+
+  /**
+   * Scratch space
+   */
+  mutable std::vector<Number> _work[2];
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_TENSOR_PRODUCT_BASIS_H
@@ -135,6 +135,15 @@ public:
    */
   virtual ~Elem();
 
+  /**
+   * Elements are allocated from slabs of same-sized objects by the
+   * \p SlabAllocator, so that elements built together are contiguous
+   * in memory and destroying a mesh doesn't free them one at a time.
+   */
+  static void * operator new (std::size_t size);
+
+  static void operator delete (void * p, std::size_t size);
+
   /**
    * \returns The \p Point associated with local \p Node \p i.
    */
@@ -27,6 +27,7 @@
 #include "libmesh/auto_ptr.h" // libmesh_make_unique
 
 // C++ includes
+#include <cstddef>
 #include <iostream>
 #include <vector>
 
@@ -98,6 +99,15 @@ public:
    */
   ~Node ();
 
+  /**
+   * Nodes are allocated from slabs by the \p SlabAllocator, so that
+   * nodes built together are contiguous in memory and destroying a
+   * mesh doesn't free them one at a time.
+   */
+  static void * operator new (std::size_t size);
+
+  static void operator delete (void * p, std::size_t size);
+
   /**
    * Assign to a node from a point.
    */
@@ -592,6 +592,22 @@ public:
   unsigned int side_with_boundary_id(const Elem * const elem,
                                      const boundary_id_type boundary_id) const;
 
+  /**
+   * \returns The (element, side) pairs on which side boundary id \p
+   * boundary_id is set, ordered by element id and side number.
+   *
+   * The first call after any change to the side boundary ids builds
+   * an index over every side boundary id at once; subsequent calls
+   * only look up \p boundary_id in that index, so that looping over
+   * the sides of one boundary costs O(number of such sides) rather
+   * than a scan over every boundary side in the mesh.
+   *
+   * \note The returned reference is invalidated by any subsequent
+   * addition or removal of side boundary ids.
+   */
+  const std::vector<std::pair<const Elem *, unsigned short int>> &
+  sides_with_boundary_id (const boundary_id_type boundary_id) const;
+
   /**
    * Builds the list of unique node boundary ids.
    *
@@ -921,6 +937,11 @@ private:
                       std::map<std::pair<dof_id_type, unsigned char>, dof_id_type> * side_id_map,
                       const std::set<subdomain_id_type> & subdomains_relative_to);
 
+  /**
+   * Discards the reverse side index, to be rebuilt on next use.
+   */
+  void _invalidate_side_id_index ();
+
   /**
    * The Mesh this boundary info pertains to.
    */
@@ -957,6 +978,18 @@ private:
                 std::pair<unsigned short int, boundary_id_type>>
   _boundary_side_id;
 
+  /**
+   * Reverse index from each side boundary id to the (element, side)
+   * pairs carrying it, built on demand by sides_with_boundary_id().
+   * Every modification of \p _boundary_side_id clears it and resets
+   * \p _side_id_index_valid.
+   */
+  mutable std::map<boundary_id_type,
+                   std::vector<std::pair<const Elem *, unsigned short int>>>
+  _side_id_index;
+
+  mutable bool _side_id_index_valid;
+
   /**
    * A collection of user-specified boundary ids for sides, edges, nodes,
    * and shell faces.
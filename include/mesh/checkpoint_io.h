@@ -28,6 +28,7 @@
 #include "libmesh/parallel_object.h"
 
 // C++ includes
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -116,6 +117,16 @@ public:
    */
   virtual void write (const std::string & name) override;
 
+  /**
+   * Like write(), except that only the header file is written before
+   * this returns.  The contents of each split file are copied into
+   * memory in the layout used by mapped(), whatever that flag says,
+   * and the returned function writes them out.  It touches neither
+   * the mesh nor any communicator, so it may be called later, or on
+   * another thread, while the mesh changes.
+   */
+  std::function<void()> write_deferred (const std::string & name);
+
   /**
    * Used to remove a checkpoint directory and its corresponding files.  This effectively undoes
    * all the work done be calls to write(...).  For example, if a checkpoint configuration was
@@ -145,6 +156,23 @@ public:
   bool   binary() const { return _binary; }
   bool & binary()       { return _binary; }
 
+  /**
+   * Get/Set the flag indicating if we should write split files in
+   * the memory-mapped layout: a small header followed by aligned,
+   * fixed-width arrays of node coordinates, connectivity, ids,
+   * processor ids and boundary data.  Such files are read by mapping
+   * them and copying out of the arrays directly, rather than by
+   * decoding them value by value.  The header file is still written
+   * according to binary().
+   *
+   * Reading detects the split file layout automatically, so this
+   * flag only affects writing.  The memory-mapped layout uses native
+   * byte order and Real precision, and can only be read back on a
+   * machine and build that agree with the one that wrote it.
+   */
+  bool   mapped() const { return _mapped; }
+  bool & mapped()       { return _mapped; }
+
   /**
    * Get/Set the flag indicating if we should read/write binary.
    */
@@ -196,6 +224,14 @@ private:
   //---------------------------------------------------------------------------
   // Write Implementation
 
+  /**
+   * Implements write() and write_deferred(); split files are written
+   * immediately if \p deferred_writes is null, and otherwise a
+   * function to write each is added to it.
+   */
+  void write_impl (const std::string & name,
+                   std::vector<std::function<void()>> * deferred_writes);
+
   /**
    * Write subdomain name information
    */
@@ -238,6 +274,17 @@ private:
    */
   void write_bc_names (Xdr & io, const BoundaryInfo & info, bool is_sideset) const;
 
+  /**
+   * Write part of a mesh to a split file in the memory-mapped layout,
+   * or defer that as in write_impl()
+   */
+  void write_mapped_subfile (const std::string & file_name,
+                             const std::set<const Elem *, CompareElemIdsByLevel> & elements,
+                             const std::set<const Node *> & nodeset,
+                             const std::vector<std::tuple<dof_id_type, unsigned short int, boundary_id_type>> & bc_triples,
+                             const std::vector<std::tuple<dof_id_type, boundary_id_type>> & bc_tuples,
+                             std::vector<std::function<void()>> * deferred_writes) const;
+
 
   //---------------------------------------------------------------------------
   // Read Implementation
@@ -256,6 +303,11 @@ private:
   template <typename file_id_type>
   void read_subfile(Xdr & io, bool expect_all_remote);
 
+  /**
+   * Read a non-header file written in the memory-mapped layout
+   */
+  void read_mapped_subfile(const std::string & file_name, bool expect_all_remote);
+
   /**
    * Read subdomain name information
    */
@@ -325,6 +377,7 @@ private:
   processor_id_type select_split_config(const std::string & input_name, header_id_type & data_size);
 
   bool _binary;
+  bool _mapped;
   bool _parallel;
   std::string _version;
 
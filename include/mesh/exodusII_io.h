@@ -259,6 +259,23 @@ public:
                                  const std::vector<Number> &,
                                  const std::vector<std::string> &) override;
 
+  /**
+   * Write out a nodal solution from a parallel vector.  When writing
+   * in chunks, processor 0 gathers and writes it a chunk of nodes at
+   * a time; otherwise it is localized and written as above.
+   */
+  virtual void write_nodal_data (const std::string &,
+                                 const NumericVector<Number> &,
+                                 const std::vector<std::string> &) override;
+
+  /**
+   * Write out the mesh and a nodal solution.  When writing in
+   * chunks, neither the mesh nor the solution is serialized.
+   */
+  virtual void write_equation_systems (const std::string &,
+                                       const EquationSystems &,
+                                       const std::set<std::string> * system_names=nullptr) override;
+
   /**
    * Write out a discontinuous nodal solution.
    */
@@ -388,6 +405,20 @@ public:
    */
   void append(bool val);
 
+  /**
+   * If true, this flag will cause the ExodusII_IO object to write
+   * continuous output without serializing the mesh or the solution:
+   * each processor sends what it owns to processor 0 for at most
+   * \p chunk_size nodes or elements at a time, and processor 0 writes
+   * each chunk as it arrives.  The file written is the same.
+   *
+   * This requires Exodus v5.22 or newer and a mesh without edge
+   * boundary ids, and the nodes will be renumbered contiguously if
+   * they are not already.  Element data and discontinuous output
+   * still serialize the mesh.
+   */
+  void write_in_chunks(bool val, dof_id_type chunk_size = 262144);
+
   /**
    * Return list of the elemental variable names
    */
@@ -443,6 +474,12 @@ private:
    * rather than created from scratch when writing.
    */
   bool _append;
+
+  /**
+   * The number of nodes or elements written at a time by
+   * write_in_chunks() output, or 0 to serialize the mesh instead.
+   */
+  dof_id_type _chunk_size;
 #endif
 
   /**
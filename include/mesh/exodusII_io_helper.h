@@ -315,6 +315,22 @@ public:
    */
   virtual void write_nodesets(const MeshBase & mesh);
 
+  /**
+   * Does the work of initialize(), write_nodal_coordinates(),
+   * write_elements(), write_sidesets() and write_nodesets(), writing
+   * the same (continuous) file, but without requiring \p mesh to be
+   * serialized.  Each processor sends the nodes and active elements
+   * it owns to processor 0, for at most \p chunk_size node or element
+   * ids at a time, and processor 0 writes each chunk as it arrives.
+   *
+   * This function must be called on all processors.  It requires
+   * Exodus v5.22 or newer, a contiguous node numbering, and no edge
+   * boundary ids.  It does not fill in libmesh_elem_num_to_exodus.
+   */
+  void write_mesh_in_chunks(std::string title,
+                            const MeshBase & mesh,
+                            dof_id_type chunk_size);
+
   /**
    * Sets up the nodal variables
    */
@@ -400,6 +416,22 @@ public:
    */
   void write_nodal_values(int var_id, const std::vector<Real> & values, int timestep);
 
+  /**
+   * Writes the vector of values to a nodal variable, for the
+   * consecutive nodes starting with the (0-based) node \p first_node.
+   * Unlike write_nodal_values(), this does not flush the file; call
+   * flush() once all the pieces have been written.
+   */
+  void write_partial_nodal_values(int var_id,
+                                  const std::vector<Real> & values,
+                                  int timestep,
+                                  dof_id_type first_node);
+
+  /**
+   * Flushes any buffered data to the file.
+   */
+  void flush();
+
   /**
    * Writes the vector of information records.
    */
@@ -827,6 +859,31 @@ private:
                             int & count,
                             const std::vector<std::string> & names);
 
+  /**
+   * initialize() and write_mesh_in_chunks() dispatch to this function
+   * to write the file parameters, once the num_* members are set.
+   */
+  void write_init_params(std::string title, dof_id_type n_active_elem);
+
+  /**
+   * write_sidesets() and write_mesh_in_chunks() dispatch to this
+   * function to write the (Exodus element, Exodus side) lists of each
+   * of \p side_boundary_ids.
+   */
+  void write_sideset_lists(const MeshBase & mesh,
+                           const std::vector<boundary_id_type> & side_boundary_ids,
+                           std::map<int, std::vector<int>> & elem,
+                           std::map<int, std::vector<int>> & side);
+
+  /**
+   * write_nodesets() and write_mesh_in_chunks() dispatch to this
+   * function to write the (node, boundary id) tuples \p bc_tuples,
+   * sorted by boundary id.
+   */
+  void write_nodeset_lists(const MeshBase & mesh,
+                           const std::vector<BoundaryInfo::NodeBCTuple> & bc_tuples,
+                           const std::vector<boundary_id_type> & node_boundary_ids);
+
   /**
    * Defines equivalence classes of Exodus element types that map to
    * libmesh ElemTypes.
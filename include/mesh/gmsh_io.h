@@ -68,8 +68,9 @@ public:
   GmshIO (const MeshBase & mesh);
 
   /**
-   * Reads in a mesh in the Gmsh *.msh format from the ASCII file
-   * given by name.
+   * Reads in a mesh in the Gmsh *.msh format from the file given by
+   * name.  ASCII files of format versions 2 and 4.1 and binary files
+   * of format version 4.1 are supported.
    *
    * \note The user is responsible for calling Mesh::prepare_for_use()
    * after reading the mesh and before using it.
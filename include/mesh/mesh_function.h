@@ -254,6 +254,39 @@ public:
                 std::vector<Tensor> & output,
                 const std::set<subdomain_id_type> * subdomain_ids = nullptr);
 
+  /**
+   * Computes values at each of the coordinates \p points and for time
+   * \p time, optionally restricting the points to the passed
+   * subdomain_ids.  The value of the \p v-th variable at \p points[i]
+   * is stored in \p output[i*n_vars + v], where n_vars is the number
+   * of variables of this function.  Points outside the mesh get the
+   * out-of-mesh value, which must then have n_vars entries.
+   *
+   * The points are grouped by the element containing them, so that
+   * the inverse map and the shape functions are evaluated once for
+   * all the points in an element.  For large sets of points this is
+   * much faster than evaluating point by point.
+   */
+  void operator() (const std::vector<Point> & points,
+                   const Real time,
+                   std::vector<Number> & output,
+                   const std::set<subdomain_id_type> * subdomain_ids = nullptr);
+
+  /**
+   * Computes gradients at each of the coordinates \p points and for
+   * time \p time, optionally restricting the points to the passed
+   * subdomain_ids.  The gradient of the \p v-th variable at \p
+   * points[i] is stored in \p output[i*n_vars + v], where n_vars is
+   * the number of variables of this function.  Points outside the
+   * mesh get zero gradients.
+   *
+   * As with the values, the points are evaluated element by element.
+   */
+  void gradient (const std::vector<Point> & points,
+                 const Real time,
+                 std::vector<Gradient> & output,
+                 const std::set<subdomain_id_type> * subdomain_ids = nullptr);
+
   /**
    * \returns The current \p PointLocator object, for use elsewhere.
    *
@@ -312,6 +345,23 @@ protected:
   const Elem * find_element(const Point & p,
                             const std::set<subdomain_id_type> * subdomain_ids = nullptr) const;
 
+  /**
+   * Finds the element for each of the \p points at once, as \p
+   * find_element() does for one point, storing the element for \p
+   * points[i] in \p elements[i].
+   */
+  void find_element(const std::vector<Point> & points,
+                    std::vector<const Elem *> & elements,
+                    const std::set<subdomain_id_type> * subdomain_ids = nullptr) const;
+
+  /**
+   * \returns The \p element containing \p p if we can evaluate on it,
+   * otherwise a local element sharing \p p, or \p nullptr if there is
+   * none.  Helper function to reduce code duplication.
+   */
+  const Elem * check_found_element(const Elem * element,
+                                   const Point & p) const;
+
   /**
    * \returns All elements that are close to a point \p p.
    *
@@ -74,6 +74,16 @@ public:
                                  const std::vector<Number> &,
                                  const std::vector<std::string> &) override;
 
+  /**
+   * Writes the equation systems \p es.  ASCII files are written one
+   * block of nodes at a time as EquationSystems::stream_solution_vector()
+   * provides their values, so that the whole solution vector is never
+   * gathered on processor 0.
+   */
+  virtual void write_equation_systems (const std::string &,
+                                       const EquationSystems &,
+                                       const std::set<std::string> * system_names=nullptr) override;
+
   /**
    * Flag indicating whether or not to write a binary file
    * (if the tecio.a library was found by \p configure).
@@ -117,6 +127,24 @@ private:
                     const std::vector<Number> * = nullptr,
                     const std::vector<std::string> * = nullptr);
 
+  /**
+   * Writes the ASCII file header, naming the variables
+   * \p solution_names if they are provided.
+   */
+  void write_ascii_header (std::ostream & out_stream,
+                           const std::vector<std::string> * solution_names);
+
+  /**
+   * Writes the \p n_nodes nodes starting from \p first_node to an
+   * ASCII file, with their \p n_vars values each from \p v if it is
+   * provided.
+   */
+  void write_ascii_nodes (std::ostream & out_stream,
+                          dof_id_type first_node,
+                          dof_id_type n_nodes,
+                          const Number * v,
+                          std::size_t n_vars);
+
   /**
    * This method implements writing a mesh with nodal data to a
    * specified file where the nodal data and variable names are optionally
@@ -0,0 +1,123 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_VTU_IO_H
+#define LIBMESH_VTU_IO_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/mesh_output.h"
+
+// C++ includes
+#include <string>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class MeshBase;
+
+/**
+ * This class implements writing meshes and nodal data in the VTK XML
+ * unstructured grid (.vtu) format, and the parallel (.pvtu) format
+ * which collects a .vtu piece from each processor, without using the
+ * VTK library.
+ *
+ * Each processor writes the active elements it owns, and the nodes
+ * of those elements, to its own piece; nothing is gathered.  For a
+ * file named "out.pvtu", processor p writes "out_p.vtu" and processor
+ * 0 also writes "out.pvtu".  A ".vtu" name can only be written by a
+ * single processor.
+ *
+ * The data arrays are written as raw binary data appended to the XML
+ * header of each piece, compressed with zlib if set_compression() is
+ * used.  Nodal solutions are written with each processor reading
+ * only the values it needs from a parallel solution vector.
+ */
+class VTUIO : public MeshOutput<MeshBase>
+{
+public:
+  /**
+   * Constructor.  Takes a reference to a constant mesh object.
+   * This constructor will only allow us to write the mesh.
+   */
+  explicit
+  VTUIO (const MeshBase &);
+
+  /**
+   * This method implements writing a mesh to a specified file.
+   */
+  virtual void write (const std::string &) override;
+
+  /**
+   * Bring in base class functionality for name resolution and to
+   * avoid warnings about hidden overloaded virtual functions.
+   */
+  using MeshOutput<MeshBase>::write_nodal_data;
+
+  /**
+   * This method implements writing a mesh with nodal data to a
+   * specified file where the nodal data and variable names are provided.
+   */
+  virtual void write_nodal_data (const std::string &,
+                                 const std::vector<Number> &,
+                                 const std::vector<std::string> &) override;
+
+  /**
+   * This method implements writing a mesh with nodal data from a
+   * parallel, node-major solution vector.  Each processor only
+   * gathers the values at the nodes of its own piece.
+   */
+  virtual void write_nodal_data (const std::string &,
+                                 const NumericVector<Number> &,
+                                 const std::vector<std::string> &) override;
+
+  /**
+   * Setter for compression flag.  Compression requires zlib.
+   */
+  void set_compression (bool b);
+
+private:
+
+  /**
+   * Writes the piece of this processor, and the .pvtu file if asked
+   * for one.  \p values holds the \p names.size() values at each of
+   * the nodes \p piece_nodes, node by node.
+   */
+  void write_pieces (const std::string & fname,
+                     const std::vector<dof_id_type> & piece_nodes,
+                     const std::vector<Number> & values,
+                     const std::vector<std::string> & names);
+
+  /**
+   * \returns The sorted ids of the nodes of the active elements this
+   * processor owns.
+   */
+  std::vector<dof_id_type> piece_nodes () const;
+
+  /**
+   * Flag to indicate whether the output should be compressed
+   */
+  bool _compress;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_VTU_IO_H
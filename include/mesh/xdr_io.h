@@ -125,6 +125,22 @@ public:
    */
   void set_auto_parallel ();
 
+  /**
+   * Report whether we may read files in parallel.  When this is set
+   * (the default) and we are reading a binary 1.6.0+ file without
+   * refinement levels into a DistributedMesh, each processor reads
+   * only its own range of blocks, using the block index at the end of
+   * the file, and the distributed mesh is assembled without
+   * broadcasting the file contents.  Otherwise processor 0 reads the
+   * whole file and broadcasts it.
+   */
+  bool read_parallel() const { return _read_parallel; }
+
+  /**
+   * Allow or forbid reading files in parallel.
+   */
+  void set_read_parallel (bool do_parallel = true) { _read_parallel = do_parallel; }
+
   /**
    * Get/Set the version string.  Valid version strings:
    *
@@ -201,8 +217,60 @@ public:
    */
   bool version_at_least_1_3_0() const;
 
+  /**
+   * \returns \p true if the current file has an XDR/XDA version that
+   * matches or exceeds 1.6.0.
+   *
+   * In this version we add the offset of a block index to the
+   * header, and write that index at the end of binary files, so that
+   * they can be read in parallel.  ASCII files are still written as
+   * version 1.3.0 when this version is requested.
+   */
+  bool version_at_least_1_6_0() const;
+
 private:
 
+  /**
+   * The byte offsets of blocks of data in a binary file, recorded
+   * while writing.  Element records have variable length, so we
+   * record the offset of every \p index_blksize element records in
+   * file order; for nodes and boundary conditions we likewise record
+   * every \p index_blksize nodes or conditions.
+   */
+  struct BlockIndex
+  {
+    /**
+     * The offset of the names and count which begin a boundary
+     * condition section, and of the blocks of conditions in it.
+     */
+    struct BCSection
+    {
+      new_header_id_type start = 0;
+      std::vector<new_header_id_type> blocks;
+    };
+
+    new_header_id_type n_levels = 0;
+
+    std::vector<new_header_id_type> elem_blocks;
+    std::vector<new_header_id_type> node_blocks;
+    std::vector<new_header_id_type> unique_id_blocks;
+
+    BCSection side_bcs, nodesets, edge_bcs, shellface_bcs;
+
+    /**
+     * \returns The section for \p bc_type, which is "side",
+     * "nodeset", "edge", or "shellface".
+     */
+    BCSection & bc_section (const std::string & bc_type);
+
+    /**
+     * Flatten the index into (or rebuild it from) the single vector
+     * which we write to file and broadcast.
+     */
+    std::vector<new_header_id_type> pack () const;
+    void unpack (const std::vector<new_header_id_type> & packed);
+  };
+
 
   //---------------------------------------------------------------------------
   // Write Implementation
@@ -214,40 +282,40 @@ private:
   /**
    * Write the connectivity for a parallel, distributed mesh
    */
-  void write_serialized_connectivity (Xdr & io, const dof_id_type n_elem) const;
+  void write_serialized_connectivity (Xdr & io, const dof_id_type n_elem, BlockIndex * index) const;
 
   /**
    * Write the nodal locations for a parallel, distributed mesh
    */
-  void write_serialized_nodes (Xdr & io, const dof_id_type n_nodes) const;
+  void write_serialized_nodes (Xdr & io, const dof_id_type n_nodes, BlockIndex * index) const;
 
   /**
    * Helper function used in write_serialized_side_bcs, write_serialized_edge_bcs, and
    * write_serialized_shellface_bcs.
    */
-  void write_serialized_bcs_helper (Xdr & io, const new_header_id_type n_side_bcs, const std::string bc_type) const;
+  void write_serialized_bcs_helper (Xdr & io, const new_header_id_type n_side_bcs, const std::string bc_type, BlockIndex * index) const;
 
   /**
    * Write the side boundary conditions for a parallel, distributed mesh
    */
-  void write_serialized_side_bcs (Xdr & io, const new_header_id_type n_side_bcs) const;
+  void write_serialized_side_bcs (Xdr & io, const new_header_id_type n_side_bcs, BlockIndex * index) const;
 
   /**
    * Write the edge boundary conditions for a parallel, distributed mesh.
    * NEW in 1.1.0 format.
    */
-  void write_serialized_edge_bcs (Xdr & io, const new_header_id_type n_edge_bcs) const;
+  void write_serialized_edge_bcs (Xdr & io, const new_header_id_type n_edge_bcs, BlockIndex * index) const;
 
   /**
    * Write the "shell face" boundary conditions for a parallel, distributed mesh.
    * NEW in 1.1.0 format.
    */
-  void write_serialized_shellface_bcs (Xdr & io, const new_header_id_type n_shellface_bcs) const;
+  void write_serialized_shellface_bcs (Xdr & io, const new_header_id_type n_shellface_bcs, BlockIndex * index) const;
 
   /**
    * Write the boundary conditions for a parallel, distributed mesh
    */
-  void write_serialized_nodesets (Xdr & io, const new_header_id_type n_nodesets) const;
+  void write_serialized_nodesets (Xdr & io, const new_header_id_type n_nodesets, BlockIndex * index) const;
 
   /**
    * Write boundary names information (sideset and nodeset) - NEW in 0.9.2 format
@@ -323,6 +391,58 @@ private:
    */
   void read_serialized_bc_names(Xdr & io, BoundaryInfo & info, bool is_sideset);
 
+  /**
+   * Read the rest of the file in parallel, if it has a block index
+   * and we are reading into a DistributedMesh.  Processor 0 reads the
+   * index, then each processor opens \p name and reads its own range
+   * of element, node, and boundary condition blocks.
+   * \returns \p false, having read nothing, if the file can't be
+   * read this way.
+   */
+  template <typename T>
+  bool read_distributed (Xdr & io, const std::string & name,
+                         const std::vector<new_header_id_type> & meta_data, T);
+
+  /**
+   * Read our range of level-0 element blocks for read_distributed(),
+   * adding placeholder nodes for their connectivity.
+   */
+  template <typename T>
+  void read_distributed_connectivity (Xdr & my_io,
+                                      const std::vector<new_header_id_type> & meta_data,
+                                      const BlockIndex & index,
+                                      const std::vector<std::size_t> & elem_ranges,
+                                      T);
+
+  /**
+   * Read our range of node blocks for read_distributed(), and trade
+   * locations, unique ids, processor ids, and nodesets with the
+   * processors which have those nodes.
+   */
+  template <typename T>
+  void read_distributed_nodes (Xdr & io, Xdr & my_io, const dof_id_type n_nodes,
+                               const BlockIndex & index, T);
+
+  /**
+   * Read our range of blocks of a side, edge, or shellface boundary
+   * condition section for read_distributed(), and send each
+   * condition to the processor which has its element.
+   */
+  template <typename T>
+  void read_distributed_bcs (Xdr & io, Xdr & my_io, const std::string bc_type,
+                             const BlockIndex::BCSection & section,
+                             const std::vector<std::size_t> & elem_ranges,
+                             T);
+
+  /**
+   * Have processor 0 read the names and count which begin a boundary
+   * condition section, and broadcast them.
+   * \returns The number of conditions in the section.
+   */
+  new_header_id_type read_distributed_bc_header (Xdr & io, BoundaryInfo & info,
+                                                 const BlockIndex::BCSection & section,
+                                                 bool is_sideset);
+
   //-------------------------------------------------------------------------
   /**
    * Pack an element into a transfer buffer for parallel communication.
@@ -337,6 +457,7 @@ private:
   bool _write_serial;
   bool _write_parallel;
   bool _write_unique_id;
+  bool _read_parallel;
   unsigned int _field_width;
   std::string _version;
   std::string _bc_file_name;
@@ -348,6 +469,12 @@ private:
    * Define the block size to use for chunked IO.
    */
   static const std::size_t io_blksize;
+
+  /**
+   * Define the number of records per entry in the block index.  This
+   * divides io_blksize.
+   */
+  static const std::size_t index_blksize;
 };
 
 
@@ -168,6 +168,20 @@ public:
     _grainsize(r._grainsize)
   {}
 
+  /**
+   * NOTE: When using pthreads this constructor is MANDATORY!!!
+   *
+   * Copy constructor which sets the beginning and ending of this
+   * new range to be different from that of the one we're copying.
+   */
+  BlockedRange (const BlockedRange<T> & r,
+                const const_iterator first,
+                const const_iterator last):
+    _end(last),
+    _begin(first),
+    _grainsize(r._grainsize)
+  {}
+
   /**
    * Splits the range \p r.  The first half
    * of the range is left in place, the second
@@ -220,7 +234,7 @@ public:
   /**
    * \returns The size of the range.
    */
-  int size () const { return (_end -_begin); }
+  std::size_t size () const { return (_end -_begin); }
 
   //------------------------------------------------------------------------
   // Methods that implement Range concept
@@ -0,0 +1,167 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_DIFFUSION_PARTITIONER_H
+#define LIBMESH_DIFFUSION_PARTITIONER_H
+
+// Local Includes
+#include "libmesh/partitioner.h"
+#include "libmesh/auto_ptr.h" // libmesh_make_unique
+
+namespace libMesh
+{
+
+/**
+ * The \p DiffusionPartitioner improves the existing partitioning of
+ * a mesh instead of computing a new one, so that rebalancing a mesh
+ * after adaptive refinement moves as few elements as possible.
+ *
+ * The loads of the parts (the sums of the element costs, see
+ * \p attach_elem_costs()) are diffused over the graph of adjacent
+ * parts until the largest load is within the imbalance tolerance of
+ * the mean, or the iteration limit is hit.  Each part then gives the
+ * computed flow to each neighboring part as a layer of elements
+ * grown from their common boundary.  Only the owner of a part
+ * decides which of its elements move, so on a distributed mesh no
+ * processor needs more than its own elements and their neighbors.
+ *
+ * Without attached costs or weights, each element costs the
+ * \p default_elem_costs() estimate, (p_level+1)^dim, so that p
+ * refinement is still rebalanced.  Attach costs from
+ * \p default_elem_costs(&dof_map) for a better estimate.
+ *
+ * Meshes which have not been partitioned into \p n nonempty parts
+ * yet are partitioned from scratch with an \p SFCPartitioner.
+ *
+ * \brief Incremental partitioner based on load diffusion.
+ */
+class DiffusionPartitioner : public Partitioner
+{
+public:
+
+  /**
+   * Constructor.  Sets the default imbalance tolerance to 1.05.
+   */
+  DiffusionPartitioner () :
+    _imbalance_tolerance (1.05),
+    _initial_imbalance (1),
+    _predicted_imbalance (1),
+    _actual_imbalance (1),
+    _n_migrated_elem (0),
+    _default_elem_costs (Partitioner::default_elem_costs())
+  {}
+
+  /**
+   * Copy/move ctor, copy/move assignment operator, and destructor are
+   * all explicitly defaulted for this class.
+   */
+  DiffusionPartitioner (const DiffusionPartitioner &) = default;
+  DiffusionPartitioner (DiffusionPartitioner &&) = default;
+  DiffusionPartitioner & operator= (const DiffusionPartitioner &) = default;
+  DiffusionPartitioner & operator= (DiffusionPartitioner &&) = default;
+  virtual ~DiffusionPartitioner() = default;
+
+  /**
+   * \returns A copy of this partitioner wrapped in a smart pointer.
+   */
+  virtual std::unique_ptr<Partitioner> clone () const override
+  {
+    return libmesh_make_unique<DiffusionPartitioner>(*this);
+  }
+
+  /**
+   * Sets the ratio of the largest to the mean part load at which the
+   * diffusion stops.  Must be at least 1.
+   */
+  void set_imbalance_tolerance (const Real tol)
+  {
+    libmesh_assert_greater_equal (tol, 1);
+    _imbalance_tolerance = tol;
+  }
+
+  /**
+   * \returns The ratio of the largest to the mean part load before
+   * the last partitioning.
+   */
+  Real initial_imbalance () const { return _initial_imbalance; }
+
+  /**
+   * \returns The ratio of the largest to the mean part load that the
+   * diffusion of the last partitioning aimed for.
+   */
+  Real predicted_imbalance () const { return _predicted_imbalance; }
+
+  /**
+   * \returns The ratio of the largest to the mean part load after
+   * the last partitioning.
+   */
+  Real actual_imbalance () const { return _actual_imbalance; }
+
+  /**
+   * \returns The number of active elements which changed parts in
+   * the last partitioning.
+   */
+  dof_id_type n_migrated_elem () const { return _n_migrated_elem; }
+
+protected:
+
+  /**
+   * Partition the \p MeshBase into \p n subdomains.
+   */
+  virtual void _do_partition (MeshBase & mesh,
+                              const unsigned int n) override;
+
+private:
+
+  /**
+   * Partitions \p mesh from scratch with an \p SFCPartitioner, and
+   * updates the statistics.
+   */
+  void _initial_partition (MeshBase & mesh,
+                           const unsigned int n);
+
+  /**
+   * \returns The cost of \p elem: the sum of its attached costs,
+   * or its \p _default_elem_costs if none are attached.
+   */
+  Real elem_load (const Elem & elem) const;
+
+  /**
+   * The ratio of the largest to the mean part load at which the
+   * diffusion stops.
+   */
+  Real _imbalance_tolerance;
+
+  /**
+   * Statistics of the last partitioning.
+   */
+  Real _initial_imbalance;
+  Real _predicted_imbalance;
+  Real _actual_imbalance;
+  dof_id_type _n_migrated_elem;
+
+  /**
+   * The element costs used when none are attached.
+   */
+  ElemCostFunction _default_elem_costs;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_DIFFUSION_PARTITIONER_H
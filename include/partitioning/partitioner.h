@@ -27,14 +27,17 @@
 
 // C++ Includes
 #include <cstddef>
+#include <functional>
 #include <memory>
 #include <unordered_map>
 #include <queue>
+#include <vector>
 
 namespace libMesh
 {
 
 // Forward Declarations
+class DofMap;
 class ErrorVector;
 
 /**
@@ -54,7 +57,7 @@ public:
   /**
    * Constructor.
    */
-  Partitioner () : _weights(nullptr) {}
+  Partitioner () : _weights(nullptr), _n_constraints(1) {}
 
   /**
    * Copy/move ctor, copy/move assignment operator, and destructor are
@@ -202,6 +205,35 @@ public:
    */
   virtual void attach_weights(ErrorVector * /*weights*/) { libmesh_not_implemented(); }
 
+  /**
+   * A function computing the costs of an element, one entry per
+   * balance constraint.
+   */
+  typedef std::function<void (const Elem &, std::vector<Real> &)> ElemCostFunction;
+
+  /**
+   * Attach a function computing \p n_constraints costs for each
+   * active element.  Partitioners which support several constraints
+   * (METIS and ParMETIS) try to balance each cost separately; the
+   * others balance the sum of the costs.  Unlike weights, costs are
+   * only evaluated on the elements a processor has, so nothing of
+   * the size of the global mesh needs to be stored.  Attached costs
+   * take precedence over attached weights.
+   *
+   * \note METIS and ParMETIS truncate the costs to integers.
+   */
+  void attach_elem_costs (const ElemCostFunction & costs,
+                          const unsigned int n_constraints = 1);
+
+  /**
+   * \returns A cost function estimating the work on each element by
+   * the number of shape functions, at the element's p-level, of the
+   * variables of \p dof_map active on the element's subdomain.
+   * Without a \p dof_map the estimate is (p_level+1)^dim.  The
+   * \p dof_map must outlive the returned function.
+   */
+  static ElemCostFunction default_elem_costs (const DofMap * dof_map = nullptr);
+
 protected:
 
   /**
@@ -261,11 +293,49 @@ protected:
    */
   void assign_partitioning (const MeshBase & mesh, const std::vector<dof_id_type> & parts);
 
+  /**
+   * \returns \p true if costs or weights have been attached.
+   */
+  bool has_elem_costs () const
+  { return _elem_costs || _weights; }
+
+  /**
+   * \returns The number of balance constraints: the number of costs
+   * per element if a cost function is attached, 1 otherwise.
+   */
+  unsigned int n_constraints () const
+  { return _elem_costs ? _n_constraints : 1; }
+
+  /**
+   * Fills \p costs with the \p n_constraints() costs of \p elem, from
+   * the attached cost function if there is one, from the attached
+   * weights otherwise, or with \p default_cost if neither is attached.
+   */
+  void elem_costs (const Elem & elem,
+                   std::vector<Real> & costs,
+                   const Real default_cost = 1) const;
+
+  /**
+   * \returns The sum of the \p elem_costs() of \p elem.
+   */
+  Real elem_cost (const Elem & elem,
+                  const Real default_cost = 1) const;
+
   /**
    * The weights that might be used for partitioning.
    */
   ErrorVector * _weights;
 
+  /**
+   * The cost function that might be used for partitioning.
+   */
+  ElemCostFunction _elem_costs;
+
+  /**
+   * The number of costs computed by \p _elem_costs.
+   */
+  unsigned int _n_constraints;
+
   /**
    * Maps active element ids into a contiguous range, as needed by parallel partitioner.
    */
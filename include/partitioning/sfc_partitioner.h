@@ -34,6 +34,12 @@ namespace libMesh
  * The \p SFCPartitioner uses a Hilbert or Morton-ordered space
  * filling curve to partition the elements.
  *
+ * On a distributed mesh each processor only computes Hilbert keys
+ * for the elements it has, and the keys are sorted in parallel, so
+ * the cost scales with the local rather than the global number of
+ * elements.  A Hilbert curve is used in this case whatever the
+ * requested curve type.
+ *
  * \author Benjamin S. Kirk
  * \date 2003
  * \brief Partitioner based on different types of space filling curves.
@@ -80,6 +86,14 @@ public:
     _sfc_type = sfc_type;
   }
 
+  /**
+   * Attach weights so that each part gets a contiguous piece of the
+   * curve holding about the same total weight rather than the same
+   * number of elements.  The weights must be nonnegative and are
+   * indexed by element id.
+   */
+  virtual void attach_weights(ErrorVector * weights) override { _weights = weights; }
+
   /**
    * Called by the SubdomainPartitioner to partition elements in the range (it, end).
    */
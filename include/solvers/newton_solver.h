@@ -142,6 +142,14 @@ public:
    */
   double linear_tolerance_multiplier;
 
+  /**
+   * If this is set, linear solves use it as the Jacobian in place of
+   * the system matrix, which is then neither assembled nor used.
+   * FEMSystem sets this to an FEMSystemShellMatrix when its
+   * matrix_free_jacobian option is enabled.
+   */
+  const ShellMatrix<Number> * jacobian_shell_matrix;
+
 protected:
 
   /**
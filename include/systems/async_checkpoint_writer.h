@@ -0,0 +1,157 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_ASYNC_CHECKPOINT_WRITER_H
+#define LIBMESH_ASYNC_CHECKPOINT_WRITER_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/equation_systems.h"
+#include "libmesh/parallel_object.h"
+
+// C++ includes
+#include <deque>
+#include <memory>
+#include <string>
+
+namespace libMesh
+{
+
+/**
+ * Writes restart files for an EquationSystems, and optionally its
+ * mesh, in the background.
+ *
+ * Each call to write() takes a snapshot: the header files are written
+ * and each processor's share of the solution data and of the mesh is
+ * copied into memory, which is the only part the caller waits for.
+ * A background thread on each processor then writes its snapshot to
+ * disk, compressing it if the file name asks for that, while the
+ * caller goes on changing the solution or the mesh.  The background
+ * thread does no communication, so MPI needs no thread support.
+ *
+ * The systems are written as by EquationSystems::write() with
+ * WRITE_PARALLEL_FILES, and can be read back with
+ * EquationSystems::read().  The mesh is written as by a binary
+ * CheckpointIO in its memory-mapped layout, and can be read back
+ * with CheckpointIO::read().
+ *
+ * At most max_in_flight() snapshots are kept at a time; write()
+ * first waits for the oldest ones to finish if need be, which bounds
+ * the memory used.  Without thread support, write() simply finishes
+ * writing before it returns.
+ */
+class AsyncCheckpointWriter : public ParallelObject
+{
+private:
+  struct Job;
+
+public:
+  /**
+   * Refers to the writing of one snapshot on this processor.
+   */
+  class Handle
+  {
+  public:
+    Handle () = default;
+
+    /**
+     * \returns \p true if this processor has finished writing the
+     * snapshot (or if this handle refers to none).
+     */
+    bool done () const;
+
+    /**
+     * Blocks until this processor has finished writing the snapshot,
+     * and rethrows any exception that writing it threw.
+     */
+    void wait () const;
+
+  private:
+    friend class AsyncCheckpointWriter;
+
+    explicit Handle (std::shared_ptr<Job> job) : _job(std::move(job)) {}
+
+    std::shared_ptr<Job> _job;
+  };
+
+  /**
+   * Constructor.  Keeps at most \p max_in_flight unfinished
+   * snapshots of \p es at a time.
+   */
+  explicit
+  AsyncCheckpointWriter (const EquationSystems & es,
+                         unsigned int max_in_flight = 1);
+
+  /**
+   * Destructor.  Waits for any unfinished snapshots.
+   */
+  ~AsyncCheckpointWriter ();
+
+  /**
+   * Snapshots the systems into \p name and, if \p mesh_name is not
+   * empty, the mesh into \p mesh_name, and starts writing them in
+   * the background.  \p write_flags and \p partition_agnostic are
+   * as for EquationSystems::write(); XDR or XDA output is chosen
+   * from \p name the same way, and a name ending in .gz or .bz2
+   * gives compressed files.
+   *
+   * This must be called on every processor.
+   */
+  Handle write (const std::string & name,
+                const std::string & mesh_name = "",
+                const unsigned int write_flags = EquationSystems::WRITE_DATA,
+                bool partition_agnostic = true);
+
+  /**
+   * Blocks until every snapshot has been written on this processor,
+   * and rethrows the first exception any of them threw.
+   */
+  void wait_all ();
+
+  /**
+   * \returns The number of snapshots this processor has not finished
+   * writing yet.
+   */
+  unsigned int n_in_flight ();
+
+  /**
+   * Get/Set the number of unfinished snapshots to allow.
+   */
+  unsigned int max_in_flight () const { return _max_in_flight; }
+  void set_max_in_flight (unsigned int max_in_flight);
+
+private:
+  /**
+   * Stops tracking snapshots which are finished.
+   */
+  void reap ();
+
+  const EquationSystems & _es;
+
+  unsigned int _max_in_flight;
+
+  /**
+   * Unfinished snapshots, oldest first
+   */
+  std::deque<std::shared_ptr<Job>> _jobs;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_ASYNC_CHECKPOINT_WRITER_H
@@ -45,6 +45,7 @@ enum XdrMODE : int;
 
 // C++ includes
 #include <cstddef>
+#include <functional>
 #include <map>
 #include <set>
 #include <string>
@@ -314,6 +315,26 @@ public:
   void build_solution_vector (std::vector<Number> & soln,
                               const std::set<std::string> * system_names=nullptr) const;
 
+  /**
+   * A version of build_solution_vector which never gathers more than
+   * \p block_size nodes of the solution at once.  The node-major
+   * solution values of nodes \p first_node through \p first_node +
+   * \p n_nodes - 1 are passed to \p sink on processor 0, block after
+   * block in order of node id, so that output formats can write the
+   * solution without holding all of it.  The entries of each node
+   * correspond to the names from \p build_variable_names().
+   * If systems_names!=nullptr, only include data from the
+   * specified systems.
+   *
+   * This function must be called on all processors at once.
+   */
+  void stream_solution_vector
+  (const std::function<void(dof_id_type first_node,
+                            dof_id_type n_nodes,
+                            const std::vector<Number> & values)> & sink,
+   const std::set<std::string> * system_names=nullptr,
+   dof_id_type block_size=65536) const;
+
   /**
    * A version of build_solution_vector which is appropriate for
    * "parallel" output formats like Nemesis.
@@ -479,6 +500,19 @@ public:
               const unsigned int write_flags=(WRITE_DATA),
               bool partition_agnostic = true) const;
 
+  /**
+   * Like write() with WRITE_PARALLEL_FILES, except that only the
+   * header is written before this returns.  This processor's part
+   * of the data is copied into memory, and the returned function
+   * writes it to this processor's file.  That function touches
+   * neither the mesh, the systems nor any communicator, so it may be
+   * called later, or on another thread, while they change.
+   */
+  std::function<void()> write_deferred (const std::string & name,
+                                        const XdrMODE,
+                                        const unsigned int write_flags=(WRITE_DATA),
+                                        bool partition_agnostic = true) const;
+
   /**
    * \returns \p true when this equation system contains
    * identical data, up to the given threshold.  Delegates
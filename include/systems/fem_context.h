@@ -33,7 +33,9 @@
 
 // C++ includes
 #include <map>
+#include <memory>
 #include <set>
+#include <tuple>
 
 namespace libMesh
 {
@@ -41,6 +43,8 @@ namespace libMesh
 // Forward Declarations
 class BoundaryInfo;
 class Elem;
+class FEBatch;
+class TensorProductBasis;
 template <typename T> class FEGenericBase;
 typedef FEGenericBase<Real> FEBase;
 class QBase;
@@ -827,6 +831,36 @@ public:
   const QBase & get_edge_qrule() const
   { return *(this->_edge_qrule); }
 
+  /**
+   * Builds an FEBatch for variable \p var on elements of dimension
+   * \p dim, with the same kind of quadrature rule as this context's
+   * element FE objects, so that physics code can compute data for a
+   * whole block of same-type elements at once.
+   */
+  std::unique_ptr<FEBatch> build_element_batch_fe (unsigned int var,
+                                                   unsigned char dim);
+
+  /**
+   * Enables or disables sum factorization in interior_values() and
+   * interior_gradients(), for variables and elements which support
+   * it (see TensorProductBasis::supports()).  Sum factorization is
+   * disabled by default.
+   */
+  void set_sum_factorization (bool enable)
+  { _sum_factorization = enable; }
+
+  bool sum_factorization () const
+  { return _sum_factorization; }
+
+  /**
+   * \returns A TensorProductBasis for variable \p var on the current
+   * element and element quadrature rule, for evaluating fields or
+   * integrating residuals by sum factorization, or \p nullptr if
+   * those don't support it.  The basis is built on first use for each
+   * FE type, element type and p level, and cached.
+   */
+  const TensorProductBasis * get_tensor_product_basis (unsigned int var) const;
+
   /**
    * Tells the FEMContext that system \p sys contains the
    * isoparametric Lagrangian variables which correspond to the
@@ -1221,6 +1255,44 @@ protected:
    */
   int _extra_quadrature_order;
 
+  /**
+   * Whether to use sum factorization where possible
+   */
+  bool _sum_factorization;
+
+  /**
+   * Cached sum factorization data, by FE type, element type and p
+   * level; null where sum factorization isn't supported.
+   */
+  mutable std::map<std::tuple<FEType, ElemType, unsigned int>,
+                   std::unique_ptr<TensorProductBasis>> _tensor_product_bases;
+
+private:
+  /**
+   * Helpers for interior_values() and interior_gradients(): fill the
+   * vector by sum factorization and return \p true, if that is
+   * enabled and supported.  Only scalar values and gradients can be.
+   */
+  bool sum_factorized_values (unsigned int var,
+                              const DenseVectorBase<Number> & coef,
+                              std::vector<Number> & u_vals) const;
+
+  template<typename OutputType>
+  bool sum_factorized_values (unsigned int,
+                              const DenseVectorBase<Number> &,
+                              std::vector<OutputType> &) const
+  { return false; }
+
+  bool sum_factorized_gradients (unsigned int var,
+                                 const DenseVectorBase<Number> & coef,
+                                 std::vector<Gradient> & du_vals) const;
+
+  template<typename OutputType>
+  bool sum_factorized_gradients (unsigned int,
+                                 const DenseVectorBase<Number> &,
+                                 std::vector<OutputType> &) const
+  { return false; }
+
 private:
   /**
    * Helper function used in constructors to set up internal data.
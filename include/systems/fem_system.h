@@ -26,6 +26,7 @@
 
 // C++ includes
 #include <cstddef>
+#include <memory>
 
 namespace libMesh
 {
@@ -33,6 +34,7 @@ namespace libMesh
 // Forward Declarations
 class DiffContext;
 class FEMContext;
+class FEMSystemShellMatrix;
 
 
 /**
@@ -169,6 +171,47 @@ public:
    */
   bool fe_reinit_during_postprocess;
 
+  /**
+   * If staged_assembly is true (it is false by default), assembly()
+   * takes the active local elements in batches of
+   * staged_assembly_batch_size elements per thread.  Each thread
+   * integrates and constrains its share of a batch into private
+   * storage, without taking any lock; afterwards a single thread adds
+   * the whole batch to the global matrix and residual in mesh
+   * iteration order.  Every global entry thus receives its
+   * contributions in the same order as in a single-threaded default
+   * assembly, so results are bitwise identical to that for any
+   * number of threads.
+   *
+   * The price is the memory for one batch of element matrices and
+   * the fact that insertion no longer overlaps element integration,
+   * so this only pays off when integration dominates the cost of
+   * assembly.
+   */
+  bool staged_assembly;
+
+  /**
+   * The number of elements each thread integrates between insertions
+   * when staged_assembly is true.  Defaults to 128.
+   */
+  unsigned int staged_assembly_batch_size;
+
+  /**
+   * If matrix_free_jacobian is true (it is false by default), the
+   * system matrix is neither allocated nor assembled.  Instead, a
+   * NewtonSolver solves each linear step with an FEMSystemShellMatrix,
+   * which recomputes the element Jacobians and applies them to the
+   * Krylov vector at every multiplication.  This trades storage of
+   * the global Jacobian for repeated element assembly.
+   *
+   * This must be set before the system is initialized.  Without an
+   * assembled matrix only Jacobi-type preconditioning is available,
+   * and solves which need the matrix itself (adjoint and sensitivity
+   * solves, or other DiffSolver types) are not supported, nor are
+   * systems with SCALAR variables.
+   */
+  bool matrix_free_jacobian;
+
   /**
    * If calculating numeric jacobians is required, the FEMSystem
    * will perturb each solution vector entry by numerical_jacobian_h
@@ -241,6 +284,21 @@ public:
    */
   void numerical_nonlocal_jacobian (FEMContext & context) const;
 
+  /**
+   * Adds the product of the constrained Jacobian at the current
+   * solution with \p x_local to \p y, computing the element
+   * Jacobians on the fly.  \p x_local must be localized like
+   * \p current_local_solution, including the send list entries.
+   */
+  void matrix_free_jacobian_product (const NumericVector<Number> & x_local,
+                                     NumericVector<Number> & y);
+
+  /**
+   * Adds the diagonal of the constrained Jacobian at the current
+   * solution to \p diag, computing the element Jacobians on the fly.
+   */
+  void matrix_free_jacobian_diagonal (NumericVector<Number> & diag);
+
 protected:
   /**
    * Initializes the member data fields associated with
@@ -248,8 +306,18 @@ protected:
    */
   virtual void init_data () override;
 
+  /**
+   * Initializes the matrices, unless we are solving matrix-free.
+   */
+  virtual void init_matrices () override;
+
 private:
   std::vector<Real> _numerical_jacobian_h_for_var;
+
+  /**
+   * The Jacobian operator used when matrix_free_jacobian is set
+   */
+  std::unique_ptr<FEMSystemShellMatrix> _jacobian_shell_matrix;
 };
 
 // --------------------------------------------------------------
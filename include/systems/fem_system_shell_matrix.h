@@ -0,0 +1,79 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FEM_SYSTEM_SHELL_MATRIX_H
+#define LIBMESH_FEM_SYSTEM_SHELL_MATRIX_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/shell_matrix.h"
+
+namespace libMesh
+{
+
+// Forward declarations
+class FEMSystem;
+template <typename T> class NumericVector;
+
+/**
+ * The Jacobian of an FEMSystem at its current solution, represented
+ * without storage: every multiplication reassembles the element
+ * Jacobians, with the same physics, time solver and constraints as
+ * FEMSystem::assembly(), and applies them to the argument vector
+ * element by element.
+ *
+ * This lets a linear solver work with Jacobians too large to store,
+ * at the cost of one element assembly per Krylov iteration.  Set
+ * FEMSystem::matrix_free_jacobian to have a NewtonSolver use one.
+ */
+class FEMSystemShellMatrix : public ShellMatrix<Number>
+{
+public:
+  /**
+   * Constructor.  The operator is the Jacobian of \p sys at its
+   * current_local_solution whenever it is applied.
+   */
+  explicit
+  FEMSystemShellMatrix (FEMSystem & sys);
+
+  /**
+   * Destructor.
+   */
+  virtual ~FEMSystemShellMatrix ();
+
+  virtual numeric_index_type m () const override;
+
+  virtual numeric_index_type n () const override;
+
+  virtual void vector_mult (NumericVector<Number> & dest,
+                            const NumericVector<Number> & arg) const override;
+
+  virtual void vector_mult_add (NumericVector<Number> & dest,
+                                const NumericVector<Number> & arg) const override;
+
+  virtual void get_diagonal (NumericVector<Number> & dest) const override;
+
+private:
+
+  FEMSystem & _sys;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_FEM_SYSTEM_SHELL_MATRIX_H
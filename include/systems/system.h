@@ -1347,6 +1347,22 @@ public:
   void write_parallel_data (Xdr & io,
                             const bool write_additional_data) const;
 
+  /**
+   * Copies the values write_parallel_data() would write on this
+   * processor into \p data: the solution vector, then each
+   * additional vector if \p write_additional_data, each paired with
+   * the comment it would be written with.  Writing each buffer in
+   * turn with Xdr::data() reproduces write_parallel_data() exactly,
+   * without needing this System any more.
+   *
+   * \note This holds copies of all of the vectors at once, whereas
+   * write_parallel_data() gathers and writes them one at a time, so
+   * it should only be used when the System must be free to change
+   * before the data is written.
+   */
+  void gather_parallel_data (std::vector<std::pair<std::string, std::vector<Number>>> & data,
+                             const bool write_additional_data) const;
+
   /**
    * \returns A string containing information about the
    * system.
@@ -0,0 +1,141 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_BLOCK_GZSTREAM_H
+#define LIBMESH_BLOCK_GZSTREAM_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+#ifdef LIBMESH_HAVE_GZSTREAM
+
+// C++ includes
+#include <cstddef>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+
+namespace libMesh
+{
+
+// Forward declarations
+class BlockGzOStreambuf;
+class BlockGzIStreambuf;
+
+/**
+ * Writes a gzip file whose data is split into fixed size blocks,
+ * each compressed independently as its own gzip member.  Several
+ * blocks at a time are compressed in parallel, by up to
+ * libMesh::n_threads() threads by default.
+ *
+ * A gzip file may contain any number of members, so the result is
+ * readable by gzip, zlib and gzstream as usual.  The header of each
+ * member also records, in an extra field, the compressed and
+ * uncompressed sizes of its block; this index lets BlockGzIStream
+ * decompress blocks in parallel and seek to any uncompressed offset
+ * without decompressing what comes before it.
+ *
+ * Data is only guaranteed to have been written once the stream is
+ * closed; flushing the stream does not end a block.
+ */
+class BlockGzOStream : public std::ostream
+{
+public:
+  /**
+   * The default size of each block before compression.
+   */
+  static const std::size_t default_block_size = 1 << 20;
+
+  /**
+   * Opens \p name for writing, compressing blocks of \p block_size
+   * bytes with up to \p n_threads threads.
+   */
+  explicit
+  BlockGzOStream (const std::string & name,
+                  std::size_t block_size = default_block_size,
+                  unsigned int n_threads = libMesh::n_threads());
+
+  /**
+   * Destructor.  Closes the file if it is open.
+   */
+  ~BlockGzOStream ();
+
+  /**
+   * Compresses and writes any remaining data and closes the file.
+   */
+  void close ();
+
+private:
+  std::unique_ptr<BlockGzOStreambuf> _buf;
+};
+
+
+
+/**
+ * Reads a gzip file written by BlockGzOStream, decompressing several
+ * blocks at a time in parallel with up to libMesh::n_threads()
+ * threads by default.  The stream is seekable, using uncompressed
+ * offsets.
+ *
+ * Files without the block index, such as those written by gzip or
+ * gzstream, can't be read this way; is_indexed() tells them apart.
+ */
+class BlockGzIStream : public std::istream
+{
+public:
+  /**
+   * Opens \p name for reading, decompressing blocks with up to
+   * \p n_threads threads.  Sets the failbit if \p name can't be
+   * opened or has no block index.
+   */
+  explicit
+  BlockGzIStream (const std::string & name,
+                  unsigned int n_threads = libMesh::n_threads());
+
+  /**
+   * Destructor.
+   */
+  ~BlockGzIStream ();
+
+  /**
+   * \returns \p true if \p name is a gzip file with a block index
+   * in every member.
+   */
+  static bool is_indexed (const std::string & name);
+
+  /**
+   * \returns The number of blocks in the file.
+   */
+  std::size_t n_blocks () const;
+
+  /**
+   * \returns The size of the file once decompressed.
+   */
+  std::size_t uncompressed_size () const;
+
+private:
+  std::unique_ptr<BlockGzIStreambuf> _buf;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_HAVE_GZSTREAM
+
+#endif // LIBMESH_BLOCK_GZSTREAM_H
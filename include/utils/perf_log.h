@@ -25,16 +25,27 @@
 #include "libmesh/libmesh_common.h"
 
 // C++ includes
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <map>
-#include <stack>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
-#include <sys/time.h>
+
+#ifdef LIBMESH_HAVE_CXX11_THREAD
+# include <thread>
+#endif
 
 namespace libMesh
 {
 
+// Forward declarations
+namespace Parallel {
+class Communicator;
+}
+
 /**
  * The \p PerfData class simply contains the performance
  * data that is recorded for individual events.
@@ -72,16 +83,21 @@ public:
   double tot_time_incl_sub;
 
   /**
-   * Structure defining when the event
-   * was last started.
+   * The clock used for timing events.  It must be monotonic: wall
+   * clock adjustments would otherwise show up as negative or
+   * enormous event times.
    */
-  struct timeval tstart;
+  typedef std::chrono::steady_clock clock_type;
 
   /**
-   * Structure defining when the event
-   * was last started, including sub-events.
+   * When the event was last started.
    */
-  struct timeval tstart_incl_sub;
+  clock_type::time_point tstart;
+
+  /**
+   * When the event was last started, including sub-events.
+   */
+  clock_type::time_point tstart_incl_sub;
 
   /**
    * The number of times this event has
@@ -98,14 +114,44 @@ public:
 
   void   start ();
   void   restart ();
+  void   restart (clock_type::time_point tnow);
   double pause ();
   double pause_for(PerfData & other);
   double stopit ();
 
   int called_recursively;
 
+  /**
+   * Adds the times and counts of \p other into this object.
+   */
+  PerfData & operator+= (const PerfData & other);
+
 protected:
   double stop_or_pause(const bool do_stop);
+
+  /**
+   * \returns The time from \p begin to \p end in seconds.
+   */
+  static double seconds (clock_type::time_point begin,
+                         clock_type::time_point end)
+  { return std::chrono::duration<double>(end - begin).count(); }
+};
+
+
+
+/**
+ * An interned (header, label) pair.  Every distinct pair of strings
+ * passed to a PerfLog is assigned a small integer \p id, shared by
+ * all PerfLog objects, which indexes the per-thread event data
+ * directly.  One PerfEvent exists for each distinct pair of
+ * *pointers*, so that a call site can cache the PerfEvent for its
+ * string literals and skip the lookup on later calls.
+ */
+struct PerfEvent
+{
+  const char * label;
+  const char * header;
+  unsigned int id;
 };
 
 
@@ -118,6 +164,14 @@ protected:
  * This class is particularly useful for finding performance
  * bottlenecks.
  *
+ * Each thread logs into its own stack and event table, so events
+ * may be pushed and popped from inside threaded loops; the tables
+ * are only merged when a summary is requested.
+ *
+ * Optionally the PerfLog also keeps a timeline of the most recent
+ * events on each thread, which can be written in the Chrome trace
+ * event format for viewing in chrome://tracing or Perfetto.
+ *
  * \author Benjamin Kirk
  * \date 2003
  * \brief Responsible for timing and summarizing events.
@@ -165,6 +219,45 @@ public:
    */
   bool logging_enabled() const { return log_events; }
 
+  /**
+   * Starts recording the begin and end time of every event popped
+   * from now on, in addition to the summary data.  Each thread keeps
+   * only its \p max_events_per_thread most recent events.
+   *
+   * Times in the trace are relative to this call, so to line up the
+   * timelines of different processors, call this on all of them
+   * right after a barrier.
+   */
+  void enable_tracing(std::size_t max_events_per_thread = 262144);
+
+  /**
+   * Stops recording events for the trace; already recorded events
+   * are kept until clear().
+   */
+  void disable_tracing() { trace_events = false; }
+
+  /**
+   * \returns \p true iff event tracing is enabled
+   */
+  bool tracing_enabled() const { return trace_events; }
+
+  /**
+   * Writes the recorded events of this processor to \p filename in
+   * the Chrome trace event JSON format, one track per thread.
+   */
+  void write_trace(const std::string & filename) const;
+
+  /**
+   * Writes the recorded events of every processor in \p comm to the
+   * single file \p filename, one process per rank.  Processor 0
+   * writes the file, receiving the other processors' events one
+   * processor at a time.
+   *
+   * This is a collective operation.
+   */
+  void write_trace(const std::string & filename,
+                   const Parallel::Communicator & comm) const;
+
   /**
    * Push the event \p label onto the stack, pausing any active event.
    *
@@ -176,6 +269,13 @@ public:
   void fast_push (const char * label,
                   const char * header="");
 
+  /**
+   * Push the event with interned id \p event_id onto the stack,
+   * pausing any active event.  This is the cheapest way to log: no
+   * lookup is done at all.
+   */
+  void fast_push (unsigned int event_id);
+
   /**
    * Push the event \p label onto the stack, pausing any active event.
    *
@@ -207,6 +307,29 @@ public:
   void fast_pop (const char * label,
                  const char * header="");
 
+  /**
+   * Pop the event with interned id \p event_id off the stack,
+   * resuming any lower event.
+   */
+  void fast_pop (unsigned int event_id);
+
+  /**
+   * \returns The PerfEvent for the pair (\p label, \p header),
+   * creating it if necessary.  The same character array lifetime
+   * requirements as for fast_push() apply.  Thread safe.
+   */
+  static const PerfEvent & intern (const char * label,
+                                   const char * header="");
+
+  /**
+   * \returns The interned id for (\p label, \p header), using and
+   * updating the call site's \p cache so that repeated calls with
+   * the same pointers cost only an atomic load and two compares.
+   */
+  static unsigned int intern (const char * label,
+                              const char * header,
+                              std::atomic<const PerfEvent *> & cache);
+
   /**
    * Pop the event \p label off the stack, resuming any lower event.
    *
@@ -264,9 +387,31 @@ public:
 
   /**
    * \returns A string containing ONLY the log information
+   *
+   * If events were logged from more than one thread, their times and
+   * counts are summed over threads, and the active time is the sum
+   * of each thread's active time.
    */
   std::string get_perf_info() const;
 
+  /**
+   * \returns A table of the minimum, mean, and maximum time (without
+   * sub-events) spent in each event by those threads which logged
+   * it, or an empty string if only one thread has logged events.
+   */
+  std::string get_thread_perf_info() const;
+
+  /**
+   * \returns A table of the minimum, mean, and maximum time (without
+   * sub-events) spent in each event over all processors of \p comm.
+   * Processors which never logged an event count as spending no
+   * time in it.
+   *
+   * This is a collective operation; every processor gets the same
+   * table.
+   */
+  std::string get_parallel_perf_info(const Parallel::Communicator & comm) const;
+
   /**
    * Print the log.
    */
@@ -278,12 +423,13 @@ public:
   double get_elapsed_time() const;
 
   /**
-   * \returns The active time
+   * \returns The active time, summed over threads.
    */
   double get_active_time() const;
 
   /**
-   * Return the PerfData object associated with a label and header.
+   * Return the PerfData object associated with a label and header,
+   * summed over threads.
    */
   PerfData get_perf_data(const std::string & label, const std::string & header="");
 
@@ -299,18 +445,121 @@ public:
    * \deprecated because encapsulation is good.
    *
    * Also probably broken by the switch from string to const char *,
-   * though users who are liberal with "auto" might be safe.
+   * though users who are liberal with "auto" might be safe.  The
+   * log is no longer stored in this form, so this returns a merged
+   * copy, which is only valid until the next call.
    */
 #ifdef LIBMESH_ENABLE_DEPRECATED
-  const log_type & get_log_raw() const
-  {
-    libmesh_deprecated();
-    return log;
-  }
+  const log_type & get_log_raw() const;
 #endif
 
 private:
 
+  /**
+   * One completed event on the trace timeline.
+   */
+  struct TraceEvent
+  {
+    unsigned int event_id;
+    PerfData::clock_type::time_point begin, end;
+  };
+
+  /**
+   * The events logged by a single thread.
+   */
+  struct ThreadLog
+  {
+    ThreadLog (unsigned int number) :
+      thread_number(number), total_time(0.), n_traced(0) {}
+
+    /**
+     * \returns The data for event \p event_id, growing the table if
+     * necessary.
+     */
+    PerfData & data (unsigned int event_id)
+    {
+      if (event_id >= events.size())
+        events.resize(event_id+1);
+      return events[event_id];
+    }
+
+    /**
+     * Event data, indexed by interned event id.
+     */
+    std::vector<PerfData> events;
+
+    /**
+     * The ids of the currently running events, innermost last.
+     */
+    std::vector<unsigned int> stack;
+
+    /**
+     * Adds an event to the trace, overwriting the oldest one if the
+     * trace already holds \p capacity events.
+     */
+    void record (const TraceEvent & event, std::size_t capacity)
+    {
+      if (trace.size() < capacity)
+        trace.push_back(event);
+      else
+        trace[n_traced % capacity] = event;
+      ++n_traced;
+    }
+
+    /**
+     * Which thread this was, in order of first logging.
+     */
+    unsigned int thread_number;
+
+    /**
+     * The total running time for events recorded by this thread.
+     */
+    double total_time;
+
+    /**
+     * Stack depth and start time of the running events which began
+     * while tracing was enabled.
+     */
+    std::vector<std::pair<std::size_t, PerfData::clock_type::time_point>> trace_starts;
+
+    /**
+     * Ring buffer of the most recently completed events.
+     */
+    std::vector<TraceEvent> trace;
+
+    /**
+     * The number of events ever added to \p trace; the oldest
+     * surviving event is at n_traced % trace.size() once full.
+     */
+    std::size_t n_traced;
+  };
+
+  /**
+   * \returns The log of the calling thread, creating it on first
+   * use.
+   */
+  ThreadLog & thread_log ();
+
+  /**
+   * \returns The event data of every thread summed together,
+   * indexed by event id.
+   */
+  std::vector<PerfData> merged_events () const;
+
+  /**
+   * \returns The recorded trace events of this processor as a
+   * comma-separated list of JSON objects, labelled as processor \p
+   * pid.
+   */
+  std::string trace_json_events (processor_id_type pid) const;
+
+  /**
+   * Reports an attempt to pop \p event_id while \p top_id is the
+   * running event.
+   */
+  static void report_bad_pop (unsigned int event_id,
+                              unsigned int top_id);
+
 
   /**
    * The label for this object.
@@ -323,28 +572,57 @@ private:
   bool log_events;
 
   /**
-   * The total running time for recorded events.
+   * The time we were constructed or last cleared.
    */
-  double total_time;
+  PerfData::clock_type::time_point tstart;
 
   /**
-   * The time we were constructed or last cleared.
+   * The actual log: one per thread which has logged an event.  The
+   * ThreadLog objects are never destroyed before clear() or our own
+   * destruction, so threads may cache pointers to them.
    */
-  struct timeval tstart;
+  std::vector<std::unique_ptr<ThreadLog>> thread_logs;
 
+#ifdef LIBMESH_HAVE_CXX11_THREAD
   /**
-   * The actual log.
-   *
-   * An unsorted_map would work fine here and would be asymptotically
-   * faster, but in my tests for our log sizes there was no
-   * improvement.
+   * The thread which owns each entry of \p thread_logs.
+   */
+  std::map<std::thread::id, ThreadLog *> thread_log_owners;
+#endif
+
+  /**
+   * Guards \p thread_logs and \p thread_log_owners.
+   */
+  mutable std::mutex thread_logs_mutex;
+
+  /**
+   * Flag to optionally record a timeline of events.
+   */
+  bool trace_events;
+
+  /**
+   * The number of events each thread keeps for the trace.
+   */
+  std::size_t trace_capacity;
+
+  /**
+   * The time tracing was enabled, which is time zero in the trace.
    */
-  log_type log;
+  PerfData::clock_type::time_point trace_epoch;
 
   /**
-   * A stack to hold the current performance log trace.
+   * A number unique to this object among all PerfLog objects ever
+   * constructed, and changed by clear(), used to validate the
+   * per-thread cache in thread_log().
    */
-  std::stack<PerfData*> log_stack;
+  std::size_t serial;
+
+#ifdef LIBMESH_ENABLE_DEPRECATED
+  /**
+   * Storage for get_log_raw().
+   */
+  mutable log_type log;
+#endif
 
   /**
    * Flag indicating if print_log() has been called.
@@ -360,15 +638,6 @@ private:
   void split_on_whitespace(const std::string & input,
                            std::vector<std::string> & output) const;
 
-  /**
-   * Workaround to give us fixed pointers to character arrays for
-   * every string.  Using std::set instead might work: it won't
-   * invalidate iterators, which I *think* means it doesn't have any
-   * reason to modify or copy their contents or otherwise invalidate
-   * their c_str() pointers... but I can't prove it from the standards
-   * doc, so let's be safe.
-   */
-  std::map<std::string, const char *> non_temporary_strings;
 };
 
 
@@ -380,7 +649,7 @@ void PerfData::start ()
 {
   this->count++;
   this->called_recursively++;
-  gettimeofday (&(this->tstart), nullptr);
+  this->tstart = clock_type::now();
   this->tstart_incl_sub = this->tstart;
 }
 
@@ -389,7 +658,15 @@ void PerfData::start ()
 inline
 void PerfData::restart ()
 {
-  gettimeofday (&(this->tstart), nullptr);
+  this->tstart = clock_type::now();
+}
+
+
+
+inline
+void PerfData::restart (clock_type::time_point tnow)
+{
+  this->tstart = tnow;
 }
 
 
@@ -404,26 +681,16 @@ double PerfData::pause ()
 inline
 double PerfData::stop_or_pause(const bool do_stop)
 {
-  // save the start times, reuse the structure we have rather than create
-  // a new one.
-  const time_t
-    tstart_tv_sec  = this->tstart.tv_sec,
-    tstart_tv_usec = this->tstart.tv_usec;
-
-  gettimeofday (&(this->tstart), nullptr);
+  const clock_type::time_point tnow = clock_type::now();
 
-  const double elapsed_time = (static_cast<double>(this->tstart.tv_sec  - tstart_tv_sec) +
-                               static_cast<double>(this->tstart.tv_usec - tstart_tv_usec)*1.e-6);
+  const double elapsed_time = seconds(this->tstart, tnow);
 
   this->tot_time += elapsed_time;
 
   if (do_stop)
-    {
-      const double elapsed_time_incl_sub = (static_cast<double>(this->tstart.tv_sec  - this->tstart_incl_sub.tv_sec) +
-                                            static_cast<double>(this->tstart.tv_usec - this->tstart_incl_sub.tv_usec)*1.e-6);
+    this->tot_time_incl_sub += seconds(this->tstart_incl_sub, tnow);
 
-      this->tot_time_incl_sub += elapsed_time_incl_sub;
-    }
+  this->tstart = tnow;
 
   return elapsed_time;
 }
@@ -433,10 +700,9 @@ double PerfData::stop_or_pause(const bool do_stop)
 inline
 double PerfData::pause_for(PerfData & other)
 {
-  gettimeofday (&(other.tstart), nullptr);
+  other.tstart = clock_type::now();
 
-  const double elapsed_time = (static_cast<double>(other.tstart.tv_sec  - this->tstart.tv_sec) +
-                               static_cast<double>(other.tstart.tv_usec - this->tstart.tv_usec)*1.e-6);
+  const double elapsed_time = seconds(this->tstart, other.tstart);
   this->tot_time += elapsed_time;
 
   other.count++;
@@ -460,56 +726,117 @@ double PerfData::stopit ()
 
 
 
+inline
+PerfData & PerfData::operator+= (const PerfData & other)
+{
+  this->tot_time += other.tot_time;
+  this->tot_time_incl_sub += other.tot_time_incl_sub;
+  this->count += other.count;
+  return *this;
+}
+
+
+
 // ------------------------------------------------------------
 // PerfLog class inline member functions
+inline
+unsigned int PerfLog::intern (const char * label,
+                              const char * header,
+                              std::atomic<const PerfEvent *> & cache)
+{
+  const PerfEvent * event = cache.load(std::memory_order_acquire);
+
+  if (!event || event->label != label || event->header != header)
+    {
+      event = &PerfLog::intern(label, header);
+      cache.store(event, std::memory_order_release);
+    }
+
+  return event->id;
+}
+
+
+
 inline
 void PerfLog::fast_push (const char * label,
                          const char * header)
+{
+  if (this->log_events)
+    this->fast_push(PerfLog::intern(label, header).id);
+}
+
+
+
+inline
+void PerfLog::fast_push (unsigned int event_id)
 {
   if (this->log_events)
     {
-      // Get a reference to the event data to avoid
-      // repeated map lookups
-      PerfData * perf_data = &(log[std::make_pair(header,label)]);
+      ThreadLog & tlog = this->thread_log();
+
+      PerfData & perf_data = tlog.data(event_id);
 
-      if (!log_stack.empty())
-        total_time += log_stack.top()->pause_for(*perf_data);
+      if (!tlog.stack.empty())
+        tlog.total_time += tlog.events[tlog.stack.back()].pause_for(perf_data);
       else
-        perf_data->start();
-      log_stack.push(perf_data);
+        perf_data.start();
+      tlog.stack.push_back(event_id);
+
+      if (this->trace_events)
+        tlog.trace_starts.emplace_back(tlog.stack.size(), perf_data.tstart);
     }
 }
 
 
 
 inline
-void PerfLog::fast_pop(const char * libmesh_dbg_var(label),
-                       const char * libmesh_dbg_var(header))
+void PerfLog::fast_pop(const char * label,
+                       const char * header)
+{
+  if (this->log_events)
+    this->fast_pop(PerfLog::intern(label, header).id);
+}
+
+
+
+inline
+void PerfLog::fast_pop(unsigned int event_id)
 {
   if (this->log_events)
     {
-      libmesh_assert (!log_stack.empty());
+      ThreadLog & tlog = this->thread_log();
+
+      libmesh_assert (!tlog.stack.empty());
 
 #ifndef NDEBUG
-      PerfData * perf_data = &(log[std::make_pair(header,label)]);
-      if (perf_data != log_stack.top())
+      if (event_id != tlog.stack.back())
         {
-          libMesh::err << "PerfLog can't pop (" << header << ',' << label << ')' << std::endl;
-          libMesh::err << "From top of stack of running logs:" << std::endl;
-          for (auto i : log)
-            if (&(i.second) == log_stack.top())
-              libMesh::err << '(' << i.first.first << ',' << i.first.second << ')' << std::endl;
-
-          libmesh_assert_equal_to (perf_data, log_stack.top());
+          report_bad_pop(event_id, tlog.stack.back());
+          libmesh_assert_equal_to (event_id, tlog.stack.back());
         }
+#else
+      libmesh_ignore(event_id);
 #endif
 
-      total_time += log_stack.top()->stopit();
+      PerfData & perf_data = tlog.events[tlog.stack.back()];
+      tlog.total_time += perf_data.stopit();
 
-      log_stack.pop();
+      // Only events that started while tracing was enabled get
+      // traced; the stack depth tells us whether this is one.
+      if (!tlog.trace_starts.empty() &&
+          tlog.trace_starts.back().first == tlog.stack.size())
+        {
+          tlog.record({tlog.stack.back(), tlog.trace_starts.back().second, perf_data.tstart},
+                      trace_capacity);
+          tlog.trace_starts.pop_back();
+        }
+
+      tlog.stack.pop_back();
 
-      if (!log_stack.empty())
-        log_stack.top()->restart();
+      // Resume the parent from the time we stopped, rather than
+      // reading the clock again
+      if (!tlog.stack.empty())
+        tlog.events[tlog.stack.back()].restart(perf_data.tstart);
     }
 }
 
@@ -518,19 +845,8 @@ void PerfLog::fast_pop(const char * libmesh_dbg_var(label),
 inline
 double PerfLog::get_elapsed_time () const
 {
-  struct timeval tnow;
-
-  gettimeofday (&tnow, nullptr);
-
-  const double elapsed_time = (static_cast<double>(tnow.tv_sec  - tstart.tv_sec) +
-                               static_cast<double>(tnow.tv_usec - tstart.tv_usec)*1.e-6);
-  return elapsed_time;
-}
-
-inline
-double PerfLog::get_active_time() const
-{
-  return total_time;
+  return std::chrono::duration<double>
+    (PerfData::clock_type::now() - tstart).count();
 }
 
 } // namespace libMesh
@@ -113,6 +113,20 @@ public:
                            std::set<const Elem *> & candidate_elements,
                            const std::set<subdomain_id_type> * allowed_subdomains = nullptr) const = 0;
 
+  /**
+   * Locates the elements containing each of the \p points, as \p
+   * operator() would, storing the result for \p points[i] (or \p
+   * nullptr in out-of-mesh mode) in \p elems[i].  Optionally allows
+   * the user to restrict the subdomains searched.
+   *
+   * The base class simply locates one point after the other;
+   * subclasses can override this to exploit the locality of large
+   * batches of points.
+   */
+  virtual void locate (const std::vector<Point> & points,
+                       std::vector<const Elem *> & elems,
+                       const std::set<subdomain_id_type> * allowed_subdomains = nullptr) const;
+
   /**
    * \returns A pointer to a Node with global coordinates \p p or \p
    * nullptr if no such Node can be found.
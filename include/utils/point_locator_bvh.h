@@ -0,0 +1,155 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_POINT_LOCATOR_BVH_H
+#define LIBMESH_POINT_LOCATOR_BVH_H
+
+// Local Includes
+#include "libmesh/point_locator_base.h"
+
+// C++ includes
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward Declarations
+class MeshBase;
+class Point;
+class Elem;
+
+/**
+ * This is a point locator which searches a bounding volume hierarchy
+ * of the active elements of a mesh.  The hierarchy is stored as a
+ * flat array of nodes, built by recursively halving the elements
+ * sorted along a Morton (Z-order) curve through their bounding box
+ * centers, so a search is a loop over contiguous memory rather than
+ * a descent through a tree of objects.
+ *
+ * Large batches of points should be passed to \p locate(), which
+ * sorts the points along the same curve and searches for them on
+ * all threads.
+ *
+ * Use \p PointLocatorBase::build() with \p BVH to create objects of
+ * this type at run time.
+ */
+class PointLocatorBVH : public PointLocatorBase
+{
+public:
+  /**
+   * Constructor.  Needs the \p mesh in which the points
+   * should be located.  Optionally takes a master
+   * locator; only the master builds a hierarchy, the
+   * others simply use the master's.
+   */
+  PointLocatorBVH (const MeshBase & mesh,
+                   const PointLocatorBase * master = nullptr);
+
+  /**
+   * Destructor.
+   */
+  ~PointLocatorBVH ();
+
+  /**
+   * Clears the locator.
+   */
+  virtual void clear() override;
+
+  /**
+   * Initializes the locator, so that the \p operator() methods can
+   * be used.  A master builds the hierarchy here, using all threads.
+   */
+  virtual void init() override;
+
+  /**
+   * Locates the element in which the point with global coordinates
+   * \p p is located, optionally restricted to a set of allowed subdomains.
+   * The mutable _element member is used to cache
+   * the result and allow it to be used during the next call to
+   * operator().
+   */
+  virtual const Elem * operator() (const Point & p,
+                                   const std::set<subdomain_id_type> * allowed_subdomains = nullptr) const override;
+
+  /**
+   * Locates the set of elements which are within the close-to-point
+   * tolerance of the point with global coordinates \p p.  Optionally
+   * allows the user to restrict the subdomains searched.
+   */
+  virtual void operator() (const Point & p,
+                           std::set<const Elem *> & candidate_elements,
+                           const std::set<subdomain_id_type> * allowed_subdomains = nullptr) const override;
+
+  /**
+   * Locates the elements containing each of the \p points.  The
+   * points are visited in Morton order, split among the threads,
+   * and each thread first tries the element it found last.  The
+   * cached element used by \p operator() is not touched.
+   */
+  virtual void locate (const std::vector<Point> & points,
+                       std::vector<const Elem *> & elems,
+                       const std::set<subdomain_id_type> * allowed_subdomains = nullptr) const override;
+
+  /**
+   * Enables out-of-mesh mode.  In this mode, if asked to find a point
+   * that is contained in no mesh at all, the point locator will
+   * return nullptr instead of crashing.  Per default, this
+   * mode is off.
+   */
+  virtual void enable_out_of_mesh_mode () override;
+
+  /**
+   * Disables out-of-mesh mode (default).  If asked to find a point
+   * that is contained in no mesh at all, the point locator will now
+   * crash.
+   */
+  virtual void disable_out_of_mesh_mode () override;
+
+  /**
+   * The flat bounding volume hierarchy, defined in the
+   * implementation file.
+   */
+  struct Hierarchy;
+
+private:
+
+  /**
+   * Pointer to our hierarchy.  The hierarchy is built at run-time
+   * through \p init().  For servant PointLocators (not master),
+   * this simply points to the hierarchy of the master.
+   */
+  Hierarchy * _hierarchy;
+
+  /**
+   * Pointer to the last element that was found.
+   * Chances are that this may be close to the next call to
+   * \p operator()...
+   */
+  mutable const Elem * _element;
+
+  /**
+   * \p true if out-of-mesh mode is enabled.  See \p
+   * enable_out_of_mesh_mode() for details.
+   */
+  bool _out_of_mesh_mode;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_POINT_LOCATOR_BVH_H
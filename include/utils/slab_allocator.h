@@ -0,0 +1,74 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_SLAB_ALLOCATOR_H
+#define LIBMESH_SLAB_ALLOCATOR_H
+
+// C++ includes
+#include <cstddef>
+
+namespace libMesh
+{
+
+/**
+ * The \p SlabAllocator class hands out memory for many small objects
+ * of a few fixed sizes, such as the Nodes and Elems of a mesh.
+ *
+ * Requests are rounded up to a size class, and every size class
+ * carves its blocks out of large, geometrically growing slabs, so
+ * objects of the same type built one after another are adjacent in
+ * memory.  Freed blocks are kept on a per-class free list for reuse;
+ * once every block of a size class has been freed, all but its first
+ * slab are released, so destroying a whole mesh costs a handful of
+ * calls to the system allocator rather than one per object.
+ *
+ * Requests larger than \p max_pooled_size bytes go directly to the
+ * global operator new.  All methods are thread-safe.
+ */
+class SlabAllocator
+{
+public:
+
+  /**
+   * Requests larger than this are not pooled.
+   */
+  static const std::size_t max_pooled_size = 1024;
+
+  /**
+   * \returns A block of at least \p size bytes, aligned for any
+   * fundamental type.
+   */
+  static void * allocate (std::size_t size);
+
+  /**
+   * Returns the block \p p, which must have been obtained from
+   * allocate(size) with the same \p size.
+   */
+  static void deallocate (void * p, std::size_t size);
+
+  /**
+   * \returns The number of slabs currently held for blocks of
+   * \p size bytes.
+   */
+  static std::size_t n_slabs (std::size_t size);
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_SLAB_ALLOCATOR_H
@@ -0,0 +1,363 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_SMALL_VECTOR_H
+#define LIBMESH_SMALL_VECTOR_H
+
+// libMesh includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
+namespace libMesh
+{
+
+/**
+ * The \p SmallVector templated class provides the subset of the
+ * std::vector interface used by DofObject, for trivial types, but
+ * stores up to \p N entries inside the object itself and only
+ * allocates heap memory for larger sizes.  The inline entries share
+ * storage with the heap pointer, so a \p SmallVector takes the
+ * larger of N*sizeof(T) and sizeof(T*) bytes plus two unsigned int
+ * counts.  That matches a 24-byte std::vector when N*sizeof(T) is at
+ * most 16, but e.g. N=4 with 8-byte entries takes 40 bytes.  The
+ * saving is in the heap allocations, and their own overhead, that
+ * small buffers no longer need.
+ *
+ * This is intended for the many tiny buffers carried by mesh
+ * objects: on large meshes, giving each one its own heap allocation
+ * means tens of millions of calls to malloc and free, and puts the
+ * data for each object far away from the object itself.
+ */
+template <typename T, unsigned int N>
+class SmallVector
+{
+  static_assert(std::is_trivial<T>::value,
+                "SmallVector only supports trivial types");
+  static_assert(N > 0, "SmallVector needs some inline storage");
+
+public:
+
+  typedef T                 value_type;
+  typedef unsigned int      size_type;
+  typedef std::ptrdiff_t    difference_type;
+  typedef T &               reference;
+  typedef const T &         const_reference;
+  typedef T *               iterator;
+  typedef const T *         const_iterator;
+
+  /**
+   * Constructor.  Creates an empty vector with inline storage.
+   */
+  SmallVector () :
+    _size(0),
+    _capacity(N)
+  {}
+
+  /**
+   * Constructor.  Creates a vector of \p n copies of \p val.
+   */
+  SmallVector (size_type n, const T & val = T()) :
+    _size(0),
+    _capacity(N)
+  {
+    this->resize(n, val);
+  }
+
+  /**
+   * Copy constructor.  The copy only uses as much heap storage as it
+   * needs, so copy-and-swap shrinks a vector to fit.
+   */
+  SmallVector (const SmallVector & other) :
+    _size(0),
+    _capacity(N)
+  {
+    this->assign(other.begin(), other.end());
+  }
+
+  /**
+   * Move constructor.  Steals heap storage when there is any.
+   */
+  SmallVector (SmallVector && other) noexcept :
+    _size(0),
+    _capacity(N)
+  {
+    this->take(other);
+  }
+
+  ~SmallVector ()
+  {
+    if (!this->is_inline())
+      delete [] _storage.heap;
+  }
+
+  SmallVector & operator= (const SmallVector & other)
+  {
+    if (this != &other)
+      this->assign(other.begin(), other.end());
+    return *this;
+  }
+
+  SmallVector & operator= (SmallVector && other) noexcept
+  {
+    if (this != &other)
+      {
+        this->release();
+        this->take(other);
+      }
+    return *this;
+  }
+
+  /**
+   * Replaces our contents with a copy of the range [first, last).
+   */
+  template <typename InputIterator>
+  void assign (InputIterator first, InputIterator last)
+  {
+    const size_type n = cast_int<size_type>(std::distance(first, last));
+    _size = 0;
+    this->reserve(n);
+    std::copy(first, last, this->data());
+    _size = n;
+  }
+
+  size_type size () const { return _size; }
+
+  bool empty () const { return _size == 0; }
+
+  size_type capacity () const { return _capacity; }
+
+  /**
+   * \returns \p true iff our entries are stored inside this object
+   * rather than on the heap.
+   */
+  bool is_inline () const { return _capacity == N; }
+
+  T * data () { return this->is_inline() ? _storage.local : _storage.heap; }
+
+  const T * data () const { return this->is_inline() ? _storage.local : _storage.heap; }
+
+  iterator begin () { return this->data(); }
+  iterator end () { return this->data() + _size; }
+  const_iterator begin () const { return this->data(); }
+  const_iterator end () const { return this->data() + _size; }
+
+  T & operator[] (size_type i)
+  {
+    libmesh_assert_less (i, _size);
+    return this->data()[i];
+  }
+
+  const T & operator[] (size_type i) const
+  {
+    libmesh_assert_less (i, _size);
+    return this->data()[i];
+  }
+
+  /**
+   * Makes room for at least \p n entries, reallocating if necessary.
+   */
+  void reserve (size_type n)
+  {
+    if (n > _capacity)
+      this->reallocate(n);
+  }
+
+  void resize (size_type n, const T & val = T())
+  {
+    if (n > _capacity)
+      this->reallocate(std::max(n, 2*_capacity));
+    if (n > _size)
+      std::fill(this->data() + _size, this->data() + n, val);
+    _size = n;
+  }
+
+  void clear () { _size = 0; }
+
+  void push_back (const T & val)
+  {
+    // val might live in our own storage
+    const T copy = val;
+    if (_size == _capacity)
+      this->reallocate(2*_capacity);
+    this->data()[_size++] = copy;
+  }
+
+  /**
+   * Inserts \p val before \p pos.
+   * \returns An iterator to the inserted entry.
+   */
+  iterator insert (const_iterator pos, const T & val)
+  {
+    return this->insert(pos, &val, &val + 1);
+  }
+
+  /**
+   * Inserts the range [first, last) before \p pos.  The range may
+   * not point into this vector.
+   * \returns An iterator to the first inserted entry.
+   */
+  template <typename InputIterator>
+  iterator insert (const_iterator pos, InputIterator first, InputIterator last)
+  {
+    const size_type offset = cast_int<size_type>(pos - this->begin());
+    const size_type n = cast_int<size_type>(std::distance(first, last));
+
+    libmesh_assert_less_equal (offset, _size);
+
+    // Copy the new values before we might reallocate, in case they
+    // are a single entry of our own
+    T single_val = T();
+    if (n == 1)
+      single_val = *first;
+
+    if (_size + n > _capacity)
+      this->reallocate(std::max(_size + n, 2*_capacity));
+
+    T * d = this->data();
+    std::copy_backward(d + offset, d + _size, d + _size + n);
+    if (n == 1)
+      d[offset] = single_val;
+    else
+      std::copy(first, last, d + offset);
+    _size += n;
+
+    return d + offset;
+  }
+
+  /**
+   * Erases the range [first, last).
+   * \returns An iterator to the entry following the erased range.
+   */
+  iterator erase (const_iterator first, const_iterator last)
+  {
+    T * d = this->data();
+    const size_type offset = cast_int<size_type>(first - d);
+    const size_type n = cast_int<size_type>(last - first);
+
+    libmesh_assert_less_equal (offset + n, _size);
+
+    std::copy(d + offset + n, d + _size, d + offset);
+    _size -= n;
+
+    return d + offset;
+  }
+
+  /**
+   * Frees any excess heap storage, moving our entries back inside
+   * this object if they fit.
+   */
+  void shrink_to_fit ()
+  {
+    if (!this->is_inline() && _size < _capacity)
+      SmallVector(*this).swap(*this);
+  }
+
+  void swap (SmallVector & other)
+  {
+    SmallVector tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+
+private:
+
+  /**
+   * Moves our entries to a buffer with room for \p new_capacity
+   * entries, on the heap unless they fit in our inline storage.
+   */
+  void reallocate (size_type new_capacity)
+  {
+    libmesh_assert_greater_equal (new_capacity, _size);
+
+    if (new_capacity <= N)
+      {
+        if (!this->is_inline())
+          {
+            T * old_heap = _storage.heap;
+            std::copy(old_heap, old_heap + _size, _storage.local);
+            delete [] old_heap;
+            _capacity = N;
+          }
+        return;
+      }
+
+    T * new_heap = new T[new_capacity];
+    std::copy(this->data(), this->data() + _size, new_heap);
+    if (!this->is_inline())
+      delete [] _storage.heap;
+    _storage.heap = new_heap;
+    _capacity = new_capacity;
+  }
+
+  /**
+   * Frees any heap storage, leaving us empty.
+   */
+  void release ()
+  {
+    if (!this->is_inline())
+      delete [] _storage.heap;
+    _size = 0;
+    _capacity = N;
+  }
+
+  /**
+   * Takes the contents of (empty, inline) \p other, leaving \p other
+   * empty.
+   */
+  void take (SmallVector & other)
+  {
+    libmesh_assert(this->is_inline());
+
+    if (other.is_inline())
+      std::copy(other._storage.local, other._storage.local + other._size,
+                _storage.local);
+    else
+      _storage.heap = other._storage.heap;
+
+    _size = other._size;
+    _capacity = other._capacity;
+
+    other._size = 0;
+    other._capacity = N;
+  }
+
+  size_type _size;
+
+  /**
+   * The number of entries we have room for; equal to \p N exactly
+   * when we are using our inline storage.
+   */
+  size_type _capacity;
+
+  union
+  {
+    T * heap;
+    T local[N];
+  } _storage;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_SMALL_VECTOR_H
@@ -103,6 +103,19 @@ public:
    */
   bool is_eof();
 
+  /**
+   * \returns The current byte offset in a binary (ENCODE or DECODE)
+   * file.
+   */
+  std::size_t getpos();
+
+  /**
+   * Moves to byte offset \p pos in a binary (ENCODE or DECODE) file,
+   * so that blocks of data whose offsets are known can be read or
+   * rewritten out of order.
+   */
+  void setpos(const std::size_t pos);
+
   /**
    * \returns \p true if the file is opened in a reading
    * state, false otherwise.
@@ -64,6 +64,7 @@ AS_ECHO(["  library warnings................. : $enablewarnings"])
 AS_ECHO(["  library deprecated code support.. : $enabledeprecated"])
 AS_ECHO(["  adaptive mesh refinement......... : $enableamr"])
 AS_ECHO(["  blocked matrix/vector storage.... : $enableblockedstorage"])
+AS_ECHO(["  inline DofObject indices......... : $enableinlinedofindices"])
 AS_ECHO(["  complex variables................ : $enablecomplex"])
 AS_ECHO(["  example suite.................... : $enableexamples"])
 AS_ECHO(["  ghosted vectors.................. : $enableghosted"])
@@ -130,6 +130,22 @@ AS_IF([test "$enableblockedstorage" != no],
 # --------------------------------------------------------------
 
 
+# --------------------------------------------------------------
+# inline DofObject index storage - disabled by default
+# --------------------------------------------------------------
+AC_ARG_ENABLE(inline-dof-indices,
+              [AS_HELP_STRING([--enable-inline-dof-indices],[Store small DofObject index buffers inside each Node and Elem])],
+              enableinlinedofindices=$enableval,
+              enableinlinedofindices=no)
+
+AS_IF([test "$enableinlinedofindices" != no],
+      [
+        AC_MSG_RESULT([<<< Configuring library to store small DofObject index buffers inline >>>])
+        AC_DEFINE(ENABLE_INLINE_DOF_INDICES, 1, [Flag indicating if DofObject should store small index buffers inline rather than on the heap])
+      ])
+# --------------------------------------------------------------
+
+
 # --------------------------------------------------------------
 # legacy include paths - disabled by default
 # --------------------------------------------------------------